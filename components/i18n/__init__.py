@@ -5,15 +5,29 @@ This component generates translation tables from YAML files and provides
 runtime locale switching functionality.
 """
 
+import contextlib
+import filecmp
+import fnmatch
+import hashlib
+import heapq
+import json
 import logging
+import os
+import re
+import struct
+import sys
+import tempfile
 from pathlib import Path
 
 import esphome.codegen as cg
 import esphome.config_validation as cv
+import esphome.final_validate as fv
 from esphome import automation
-from esphome.core import CORE
+from esphome.core import CORE, Lambda
 from esphome.helpers import write_file_if_changed
-from esphome.const import CONF_ID
+from esphome.const import CONF_ID, CONF_TRIGGER_ID
+from esphome.components import web_server_base
+from esphome.components.lvgl.types import lv_label_t
 
 _LOGGER = logging.getLogger(__name__)
 
@@ -26,27 +40,174 @@ DEPENDENCIES = ["lvgl"]
 i18n_ns = cg.esphome_ns.namespace("i18n")
 I18nComponent = i18n_ns.class_("I18nComponent", cg.Component)
 SetLocaleAction = i18n_ns.class_("SetLocaleAction", automation.Action)
+I18nCatalogHandler = i18n_ns.class_("I18nCatalogHandler", cg.Component)
+LocaleChangeTrigger = i18n_ns.class_("LocaleChangeTrigger", automation.Trigger.template(cg.std_string))
 
 # ------------------ Component Schema ------------------
 
+# Strategies for resolving runtime string keys to key IDs:
+#   linear       - strcmp over all keys, no extra flash
+#   binary       - binary search over the sorted key list, no extra flash
+#   perfect_hash - minimal perfect hash with one verifying strcmp, ~2.5 bytes/key
+KEY_LOOKUP_STRATEGIES = ["linear", "binary", "perfect_hash"]
+
+# Storage of the string pool in flash:
+#   none    - plain NUL-terminated strings, readable in place
+#   huffman - canonical Huffman code over all strings, decoded on lookup
+COMPRESSION_MODES = ["none", "huffman"]
+
+# Where the translated strings live:
+#   embedded  - compiled into the firmware image
+#   partition - per-locale blobs on a data partition, mapped once selected
+STORAGE_MODES = ["embedded", "partition"]
+
+# Locale codes are stored in fixed-size fields of the partition directory
+_PART_CODE_LEN = 12
+
+def _validate_fallback(value):
+    """Mapping of locale code -> locale used for its missing keys."""
+    if not isinstance(value, dict):
+        raise cv.Invalid("fallback must map locales to the locale used for their missing keys")
+    return {cv.string_strict(k): cv.string_strict(v) for k, v in value.items()}
+
 I18N_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(I18nComponent),
         cv.Required("sources"): cv.ensure_list(cv.file_),
         cv.Optional("default_locale", default="en"): cv.string_strict,
+        # Missing keys of a locale come from its fallback, e.g. {de-AT: de, de: en}
+        cv.Optional("fallback", default={}): _validate_fallback,
+        cv.Optional("key_lookup", default="binary"): cv.one_of(*KEY_LOOKUP_STRATEGIES, lower=True),
+        cv.Optional("compression", default="none"): cv.one_of(*COMPRESSION_MODES, lower=True),
+        # Decoded strings kept in RAM when compressed, each slot holds I18N_MAX_LEN + 1 bytes
+        cv.Optional("cache_size", default=8): cv.int_range(min=1, max=64),
+        # Translations patched at runtime, kept in a fixed RAM arena checked before the flash tables
+        cv.Optional("overrides"): cv.Schema(
+            {
+                # Each override takes 6 bytes plus its text and a NUL, rounded up to even
+                cv.Required("arena_size"): cv.int_range(min=16, max=8192),
+                # Keep overrides in preferences across reboots
+                cv.Optional("restore", default=True): cv.boolean,
+            }
+        ),
+        # Keys warmed up per loop after a locale change, bound and recently viewed ones, 0 disables
+        cv.Optional("prefetch", default=0): cv.int_range(min=0, max=64),
+        cv.Optional("storage", default="embedded"): cv.one_of(*STORAGE_MODES, lower=True),
+        cv.Optional("partition", default="i18n"): cv.All(cv.string_strict, cv.Length(min=1, max=16)),
+        # One translations_<locale>.cpp per locale, compiled in parallel and rebuilt only when it changes
+        cv.Optional("split_locales", default=False): cv.boolean,
+        # Compile in only the keys used by lambdas, bindings and includes, plus those matching keep
+        cv.Optional("prune_keys", default=False): cv.boolean,
+        cv.Optional("keep", default=[]): cv.ensure_list(cv.string_strict),
+        # Fonts whose glyphs are set to the characters the translations render
+        cv.Optional("fonts", default=[]): cv.ensure_list(
+            cv.Schema(
+                {
+                    cv.Required("id"): cv.string_strict,
+                    # Locales rendered with this font, all by default
+                    cv.Optional("locales"): cv.ensure_list(cv.string_strict),
+                }
+            )
+        ),
+        # Translations and locale switching over the web_server, needs web_server:
+        cv.Optional("catalog"): cv.Schema(
+            {
+                cv.GenerateID(): cv.declare_id(I18nCatalogHandler),
+                cv.GenerateID(web_server_base.CONF_WEB_SERVER_BASE_ID): cv.use_id(web_server_base.WebServerBase),
+                # Translations per response, bounds the response buffer
+                cv.Optional("page_size", default=128): cv.int_range(min=1, max=1024),
+            }
+        ),
+        # Build fails when the translations take more flash, or one string more bytes
+        cv.Optional("max_flash_bytes"): cv.positive_int,
+        cv.Optional("max_string_length"): cv.positive_int,
+        # Per-key lookup counters, misses and lookup time, shown by dump_config and the i18n sensor
+        cv.Optional("statistics", default=False): cv.boolean,
+        cv.Optional("bindings", default=[]): cv.ensure_list(
+            cv.Schema(
+                {
+                    cv.Required("label"): cv.use_id(lv_label_t),
+                    cv.Required("key"): cv.string_strict,
+                }
+            )
+        ),
+        cv.Optional("on_locale_change"): automation.validate_automation(
+            {
+                cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(LocaleChangeTrigger),
+            }
+        ),
     }
 )
 
+# ESP8266 keeps preferences in 96 words of RTC memory or 128 words of flash, shared by all components
+_ESP8266_OVERRIDE_ARENA_MAX = 256
+
+def _validate_storage(config):
+    """
+    Partition storage maps flash through the ESP32 MMU and keeps strings uncompressed;
+    restored overrides must fit the preferences of the platform.
+    """
+    if config["storage"] == "partition":
+        if not CORE.is_esp32:
+            raise cv.Invalid("storage: partition is only supported on ESP32")
+        if config["compression"] != "none":
+            raise cv.Invalid("storage: partition cannot be combined with compression")
+        if config["split_locales"]:
+            raise cv.Invalid("split_locales only applies to storage: embedded")
+    overrides = config.get("overrides")
+    if overrides and overrides["restore"] and CORE.is_esp8266 and overrides["arena_size"] > _ESP8266_OVERRIDE_ARENA_MAX:
+        raise cv.Invalid(
+            f"overrides: arena_size {overrides['arena_size']} does not fit the ESP8266 preferences, "
+            f"use at most {_ESP8266_OVERRIDE_ARENA_MAX} bytes or restore: false"
+        )
+    return config
+
 def i18n_config_schema(config):
     """Validate i18n configuration schema."""
     if not config or isinstance(config, dict):
-        return I18N_SCHEMA(config)
+        return _validate_storage(I18N_SCHEMA(config))
     raise cv.Invalid("i18n expects a single configuration, not a list")
 
 CONFIG_SCHEMA = i18n_config_schema
 
+def _final_validate_fonts(config):
+    """Subset the fonts listed under fonts: to the glyphs of their locales."""
+    if not config.get("fonts"):
+        return config
+    sources = [Path(CORE.relative_config_path(p)) for p in config["sources"]]
+    locales_map, plurals = _load_locales_cached(sources)
+    _apply_fallbacks(locales_map, config["fallback"])
+    # Only the keys compiled in need glyphs; to_code() reports what was pruned
+    if config["prune_keys"]:
+        _prune_config_keys(config, fv.full_config.get(), locales_map, plurals, quiet=True)
+    glyphs = {loc: _locale_glyphs(flat) for loc, flat in locales_map.items()}
+
+    font_configs = {str(getattr(f[CONF_ID], "id", f[CONF_ID])): f for f in fv.full_config.get().get("font", [])}
+    for entry in config["fonts"]:
+        font = font_configs.get(entry["id"])
+        if font is None:
+            raise cv.Invalid(f"fonts: no font with id '{entry['id']}'")
+        locales = entry.get("locales", sorted(locales_map))
+        for loc in locales:
+            if loc not in locales_map:
+                raise cv.Invalid(f"fonts: locale '{loc}' of font '{entry['id']}' not found in sources")
+        # Glyphs listed on the font itself are kept, e.g. icons or characters of runtime values
+        chars = set("".join(font.get("glyphs", []))).union(*(glyphs[loc] for loc in locales))
+        # The font component takes glyphs as strings, one glyph each
+        font["glyphs"] = sorted(chars)
+        # Default glyph sets would add whole scripts back on top of the subset
+        if "glyphsets" in font:
+            font["glyphsets"] = []
+        _LOGGER.info("i18n font %s: %d glyphs for %s", entry["id"], len(chars), ", ".join(locales))
+    return config
+
+FINAL_VALIDATE_SCHEMA = _final_validate_fonts
+
 # ------------------ Action Schema ------------------
 
+SetOverrideAction = i18n_ns.class_("SetOverrideAction", automation.Action)
+ClearOverridesAction = i18n_ns.class_("ClearOverridesAction", automation.Action)
+
 SET_LOCALE_ACTION_SCHEMA = cv.Schema(
     {
         cv.GenerateID(CONF_ID): cv.use_id(I18nComponent),
@@ -63,31 +224,90 @@ async def set_locale_action_to_code(config, action_id, template_args, args):
     cg.add(var.set_locale(locale_template))
     return var
 
+SET_OVERRIDE_ACTION_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_ID): cv.use_id(I18nComponent),
+        cv.Required("key"): cv.templatable(cv.string_strict),
+        cv.Required("text"): cv.templatable(cv.string),
+        # Current locale when empty
+        cv.Optional("locale", default=""): cv.templatable(cv.string),
+    }
+)
+
+@automation.register_action("i18n.set_override", SetOverrideAction, SET_OVERRIDE_ACTION_SCHEMA)
+async def set_override_action_to_code(config, action_id, template_args, args):
+    """Register set_override action, needs the overrides: option."""
+    parent = await cg.get_variable(config[CONF_ID])
+    var = cg.new_Pvariable(action_id, template_args, parent)
+    cg.add(var.set_key(await cg.templatable(config["key"], args, cg.std_string)))
+    cg.add(var.set_text(await cg.templatable(config["text"], args, cg.std_string)))
+    cg.add(var.set_locale(await cg.templatable(config["locale"], args, cg.std_string)))
+    return var
+
+CLEAR_OVERRIDES_ACTION_SCHEMA = cv.Schema({cv.GenerateID(CONF_ID): cv.use_id(I18nComponent)})
+
+@automation.register_action("i18n.clear_overrides", ClearOverridesAction, CLEAR_OVERRIDES_ACTION_SCHEMA)
+async def clear_overrides_action_to_code(config, action_id, template_args, args):
+    """Register clear_overrides action, needs the overrides: option."""
+    parent = await cg.get_variable(config[CONF_ID])
+    return cg.new_Pvariable(action_id, template_args, parent)
+
 # ------------------ YAML Locale Utilities ------------------
 
-def _flatten_dict(prefix, obj, out):
+def _is_plural_dict(obj) -> bool:
+    """A mapping of CLDR plural categories to strings, with at least "other"."""
+    return (
+        isinstance(obj, dict)
+        and "other" in obj
+        and all(k in PLURAL_CATEGORIES for k in obj)
+        and not any(isinstance(v, (dict, list)) for v in obj.values())
+    )
+
+def _flatten_dict(prefix, obj, out, lists=None, plurals=None):
     """
     Recursively flatten nested dictionary into dot-notation keys.
     
+    Lists become a single newline-joined string (LVGL roller/dropdown options);
+    their item counts are recorded in `lists` if given. Plural entries keep
+    their "other" form under the key itself and the other categories under
+    "<key>.<category>"; their categories are recorded in `plurals` if given.
+
     Example:
         {"weather": {"cloudy": "Cloudy"}} -> {"weather.cloudy": "Cloudy"}
+        {"sleep_time": ["Never", "1 minute"]} -> {"sleep_time": "Never\\n1 minute"}
+        {"devices": {"one": "device", "other": "devices"}} -> {"devices": "devices", "devices.one": "device"}
     """
-    if isinstance(obj, dict):
+    # Keys are interned, so every locale shares one copy of each key string
+    if prefix and _is_plural_dict(obj):
+        out[sys.intern(prefix)] = str(obj["other"])
+        for cat, v in obj.items():
+            if cat != "other":
+                out[sys.intern(f"{prefix}.{cat}")] = str(v)
+        if plurals is not None:
+            plurals[sys.intern(prefix)] = set(obj)
+    elif isinstance(obj, dict):
         for k, v in obj.items():
             key = f"{prefix}.{k}" if prefix else str(k)
-            _flatten_dict(key, v, out)
+            _flatten_dict(key, v, out, lists, plurals)
+    elif isinstance(obj, list):
+        if any(isinstance(item, (dict, list)) for item in obj):
+            raise cv.Invalid(f"List translation '{prefix}' may only contain plain strings")
+        out[sys.intern(prefix)] = "\n".join(str(item) for item in obj)
+        if lists is not None:
+            lists[sys.intern(prefix)] = len(obj)
     else:
-        out[prefix] = str(obj)
+        out[sys.intern(prefix)] = str(obj)
 
 def _load_yaml_file(path: Path) -> dict:
-    """Load and parse YAML file."""
+    """Load and parse YAML file, with the C parser of libyaml when PyYAML was built with it."""
     import yaml
+    loader = getattr(yaml, "CSafeLoader", yaml.SafeLoader)
     with open(path, "r", encoding="utf-8") as f:
-        return yaml.safe_load(f) or {}
+        return yaml.load(f, Loader=loader) or {}
 
 def _cpp_escape_literal(s: str) -> str:
     """Escape string for C++ string literal."""
-    return s.replace("\\", "\\\\").replace('"', '\\"')
+    return s.replace("\\", "\\\\").replace('"', '\\"').replace("\n", "\\n").replace("\r", "\\r")
 
 def _sym_from_key(key: str) -> str:
     """
@@ -107,41 +327,1490 @@ def _sym_from_key(key: str) -> str:
         s = "_" + s
     return s
 
+def _unique_symbols(names: list[str], what: str) -> list[str]:
+    """
+    Build C++ symbols for names, rejecting names that collapse to the same symbol.
+
+    Example:
+        "weather.cloudy" and "weather_cloudy" both map to "WEATHER_CLOUDY"
+    """
+    seen: dict[str, str] = {}
+    syms = []
+    for name in names:
+        sym = _sym_from_key(name)
+        if sym in seen:
+            raise cv.Invalid(f"{what} '{seen[sym]}' and '{name}' map to the same C++ symbol '{sym}'")
+        seen[sym] = name
+        syms.append(sym)
+    return syms
+
+def _key_symbols(all_keys: list[str]) -> list[str]:
+    """Build C++ symbols for all translation keys (Key enum entries)."""
+    if len(all_keys) > 0xFFFF:
+        raise cv.Invalid(f"Too many translation keys ({len(all_keys)}), at most 65535 are supported")
+    return _unique_symbols(all_keys, "Translation keys")
+
+def _locale_symbols(locales: list[str]) -> list[str]:
+    """Build C++ symbols for all locales (Locale enum entries)."""
+    if len(locales) > 0xFF:
+        raise cv.Invalid(f"Too many locales ({len(locales)}), at most 255 are supported")
+    return _unique_symbols(locales, "Locales")
+
+def _load_locales(sources: list[Path]) -> tuple[dict[str, dict[str, str]], dict[str, list[str]]]:
+    """
+    Load and flatten all locale files into {locale: {key: text}}.
+
+    The locale name comes from the filename (e.g., "en.yaml" -> "en"); several
+    files for the same locale are merged. List entries must have the same
+    number of items in every locale, so option indexes line up.
+
+    Returns (locales_map, plurals): plurals maps every plural key to the
+    categories besides "other" used by any locale. Locales without one of
+    these forms get their "other" text in its place.
+    """
+    locales_map: dict[str, dict[str, str]] = {}
+    list_lengths: dict[str, dict[str, int]] = {}
+    plural_forms: dict[str, dict[str, set[str]]] = {}
+
+    for src in sources:
+        if not src.exists():
+            raise cv.Invalid(f"Locale file not found: {src}")
+        
+        # Locale name from filename (e.g., "en.yaml" -> "en")
+        loc = src.stem
+        
+        # Load and flatten YAML structure, one file at a time so only one parsed document is alive
+        data = _load_yaml_file(src)
+        flat = {}
+        lists = {}
+        plurals = {}
+        _flatten_dict("", data, flat, lists, plurals)
+        del data
+
+        if loc in locales_map:
+            _LOGGER.info("Updating locale %s (possibly overwriting) from %s", loc, src)
+            locales_map[loc].update(flat)
+            for k in flat:
+                list_lengths[loc].pop(k, None)
+                plural_forms[loc].pop(k, None)
+            list_lengths[loc].update(lists)
+            plural_forms[loc].update(plurals)
+        else:
+            locales_map[loc] = flat
+            list_lengths[loc] = lists
+            plural_forms[loc] = plurals
+
+    # List entries must be lists with the same item count everywhere
+    list_keys = {k for lists in list_lengths.values() for k in lists}
+    for k in sorted(list_keys):
+        counts = {loc: list_lengths[loc].get(k) for loc in locales_map if k in locales_map[loc]}
+        if len(set(counts.values())) > 1:
+            details = ", ".join(f"{loc}: {'not a list' if n is None else n}" for loc, n in sorted(counts.items()))
+            raise cv.Invalid(f"List translation '{k}' must have the same number of items in every locale ({details})")
+
+    # Every locale gets a form for each category used anywhere, so the slots line up
+    plural_keys: dict[str, list[str]] = {}
+    for base in sorted({k for forms in plural_forms.values() for k in forms}):
+        used = set().union(*(forms.get(base, set()) for forms in plural_forms.values()))
+        cats = [c for c in PLURAL_CATEGORIES if c in used and c != "other"]
+        plural_keys[base] = cats
+        for loc, flat in locales_map.items():
+            if base not in flat:
+                continue
+            own = plural_forms[loc].get(base, set())
+            needed = [c for c in _plural_rule_for(loc)[1] if c not in own]
+            if own and needed:
+                _LOGGER.warning(
+                    "Plural '%s' in locale %s has no %s form, using 'other'", base, loc, "/".join(needed)
+                )
+            for cat in cats:
+                flat.setdefault(f"{base}.{cat}", flat[base])
+
+    return locales_map, plural_keys
+
+def _apply_fallbacks(locales_map: dict[str, dict[str, str]], fallback: dict[str, str]) -> None:
+    """
+    Fill missing keys of each locale from its fallback chain (de-AT -> de -> en).
+
+    The filled slots carry the fallback's text, which the string pool stores only once.
+    """
+    for loc, parent in fallback.items():
+        if loc not in locales_map:
+            raise cv.Invalid(f"fallback: locale '{loc}' not found in sources")
+        if parent not in locales_map:
+            raise cv.Invalid(f"fallback: locale '{parent}' (fallback of '{loc}') not found in sources")
+
+    done: set[str] = set()
+
+    def _resolve(loc: str, chain: list[str]):
+        if loc in done or loc not in fallback:
+            return
+        if loc in chain:
+            raise cv.Invalid("fallback: cycle " + " -> ".join(chain + [loc]))
+        parent = fallback[loc]
+        # Complete the parent first so chains resolve transitively
+        _resolve(parent, chain + [loc])
+        missing = [k for k in locales_map[parent] if k not in locales_map[loc]]
+        for k in missing:
+            locales_map[loc][k] = locales_map[parent][k]
+        if missing:
+            _LOGGER.info("i18n locale %s: %d keys from fallback %s", loc, len(missing), parent)
+        done.add(loc)
+
+    for loc in sorted(fallback):
+        _resolve(loc, [])
+
+# ------------------ Font Glyphs ------------------
+
+# format() arguments are unknown at build time, numbers need these
+# What snprintf prints for a number argument, which may be an integer or a float:
+# digits, sign, decimal point and "inf"/"nan"; without a precision "%g" adds the
+# exponent. Formatting runs in the C locale, so the decimal separator is always '.'.
+_NUMBER_GLYPHS = "0123456789-.infa"
+_EXPONENT_GLYPHS = "e+"
+
+def _locale_glyphs(flat: dict[str, str]) -> set[str]:
+    """
+    Characters a locale can render: its texts, placeholders replaced by nothing
+    and escaped braces by one brace, plus the characters of a number for each
+    placeholder. List separators and other control characters are not glyphs.
+    """
+    chars: set[str] = set()
+    for text in flat.values():
+        if _is_template(text):
+            data = text.encode("utf-8")
+            segments = _parse_template(text)
+            text = "".join(data[pos : pos + n].decode("utf-8") for kind, pos, n in segments if kind == "text")
+            for seg in segments:
+                if seg[0] == "arg":
+                    chars.update(_NUMBER_GLYPHS)
+                    if seg[2] is None:
+                        chars.update(_EXPONENT_GLYPHS)
+        chars.update(c for c in text if c.isprintable())
+    return chars
+
+# ------------------ Dead-Key Elimination ------------------
+
+_KEY_ID_RE = re.compile(r"\bKey::([A-Za-z_][A-Za-z0-9_]*)")
+_STRING_LITERAL_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+
+def _lambda_sources(obj, out: list[str]) -> None:
+    """Collect the C++ code of every lambda in a validated config tree."""
+    if isinstance(obj, Lambda):
+        out.append(obj.value)
+    elif isinstance(obj, dict):
+        for v in obj.values():
+            _lambda_sources(v, out)
+    elif isinstance(obj, (list, tuple)):
+        for v in obj:
+            _lambda_sources(v, out)
+
+def _config_strings(obj, out: set[str]) -> None:
+    """Collect the plain string values of a config tree, such as the key: of i18n.set_override."""
+    if isinstance(obj, str):
+        out.add(obj)
+    elif isinstance(obj, dict):
+        for v in obj.values():
+            _config_strings(v, out)
+    elif isinstance(obj, (list, tuple)):
+        for v in obj:
+            _config_strings(v, out)
+
+def _used_keys(
+    all_keys: list[str],
+    sources: list[str],
+    bound: list[str],
+    keep: list[str],
+    strings: set[str] = frozenset(),
+    quiet: bool = False,
+) -> set[str]:
+    """
+    Keys reachable from C++ sources: Key:: IDs and string literals naming a key,
+    plus bound keys, config strings naming a key and keys matching a keep
+    pattern (fnmatch, e.g. "weather.*").
+
+    Dynamic keys built at runtime ("weather." + state) cannot be seen here and
+    need a keep pattern; literals that look like such a prefix are reported
+    unless quiet.
+    """
+    key_set = set(all_keys)
+    by_symbol = dict(zip(_key_symbols(all_keys), all_keys))
+    used = set(bound) | (key_set & set(strings))
+    prefixes = set()
+    for code in sources:
+        used.update(by_symbol[sym] for sym in _KEY_ID_RE.findall(code) if sym in by_symbol)
+        for lit in _STRING_LITERAL_RE.findall(code):
+            if lit in key_set:
+                used.add(lit)
+            elif lit.endswith(".") and len(lit) > 1:
+                prefixes.add(lit)
+    for pattern in keep:
+        matched = fnmatch.filter(all_keys, pattern)
+        if not matched and not quiet:
+            _LOGGER.warning("i18n keep: pattern '%s' matches no key", pattern)
+        used.update(matched)
+    if quiet:
+        return used
+    for prefix in sorted(prefixes):
+        if any(k.startswith(prefix) and k not in used for k in all_keys):
+            _LOGGER.warning(
+                "i18n prune_keys: '%s' looks like a dynamic key prefix, add '%s*' to keep if keys are built from it",
+                prefix,
+                prefix,
+            )
+    return used
+
+def _prune_keys(
+    locales_map: dict[str, dict[str, str]], plurals: dict[str, list[str]], used: set[str]
+) -> None:
+    """Drop unused keys from every locale; a plural key is kept whole if its base or any form is used."""
+    keep = set(used)
+    for base, cats in plurals.items():
+        group = {base} | {f"{base}.{cat}" for cat in cats}
+        if keep & group:
+            keep |= group
+    for base in [b for b in plurals if b not in keep]:
+        del plurals[base]
+    for flat in locales_map.values():
+        for k in [k for k in flat if k not in keep]:
+            del flat[k]
+
+# ------------------ String Pool ------------------
+
+def _uint_type_for(max_value: int) -> tuple[str, str]:
+    """Smallest unsigned C++ type holding max_value, with its PROGMEM reader."""
+    if max_value <= 0xFF:
+        return "uint8_t", "pgm_read_byte"
+    if max_value <= 0xFFFF:
+        return "uint16_t", "pgm_read_word"
+    return "uint32_t", "pgm_read_dword"
+
+def _build_string_pool(strings, tail_merge: bool = True) -> tuple[list[bytes], dict[str, tuple[int, int]]]:
+    """
+    Intern strings into a pool of NUL-terminated host strings.
+
+    Identical strings share one entry, and with tail_merge a string that is a
+    suffix of another ("Off" in "Power Off") points into that string's tail.
+
+    Returns (hosts, refs): hosts are UTF-8 encoded pool strings, refs map every
+    input string to (host index, byte offset into the host).
+    """
+    strings = set(strings)
+    unique = sorted({s.encode("utf-8") for s in strings}, key=lambda b: b[::-1])
+    host_of: dict[bytes, bytes] = {}
+    # In reversed-byte order a suffix sorts right before the strings ending with it
+    for i in range(len(unique) - 1, -1, -1):
+        s = unique[i]
+        nxt = unique[i + 1] if i + 1 < len(unique) else None
+        host_of[s] = host_of[nxt] if tail_merge and nxt is not None and nxt.endswith(s) else s
+
+    hosts = sorted({h for h in host_of.values()})
+    host_index = {h: i for i, h in enumerate(hosts)}
+    refs = {}
+    for s in strings:
+        b = s.encode("utf-8")
+        host = host_of[b]
+        refs[s] = (host_index[host], len(host) - len(b))
+    return hosts, refs
+
+# ------------------ Huffman Coder ------------------
+
+# Longest code, bounded so the decoder tables stay fixed-size
+_HUFF_MAX_BITS = 15
+
+def _huffman_code_lengths(freqs: dict[int, int]) -> dict[int, int]:
+    """Huffman code length per byte value, limited to _HUFF_MAX_BITS."""
+    if len(freqs) == 1:
+        return {sym: 1 for sym in freqs}
+    while True:
+        heap = [(f, sym, (sym,)) for sym, f in freqs.items()]
+        heapq.heapify(heap)
+        lengths = dict.fromkeys(freqs, 0)
+        tie = 256
+        while len(heap) > 1:
+            f1, _, a = heapq.heappop(heap)
+            f2, _, b = heapq.heappop(heap)
+            for sym in a + b:
+                lengths[sym] += 1
+            heapq.heappush(heap, (f1 + f2, tie, a + b))
+            tie += 1
+        if max(lengths.values()) <= _HUFF_MAX_BITS:
+            return lengths
+        # Too deep - flatten the distribution and retry, all-equal weights always fit
+        freqs = {sym: (f >> 1) | 1 for sym, f in freqs.items()}
+
+def _byte_freqs(hosts, freqs: dict[int, int]) -> None:
+    """Add the byte counts of pool strings to freqs."""
+    for host in hosts:
+        for byte in host:
+            freqs[byte] = freqs.get(byte, 0) + 1
+
+def _huffman_code(lengths: dict[int, int]) -> tuple[list[int], list[int], dict[int, tuple[int, int]]]:
+    """
+    Canonical Huffman code for the code length of each byte value.
+
+    Returns (counts, symbols, codes): codes per bit length (index 0 unused),
+    symbols in code order and (code, width) per byte value.
+    """
+    symbols = sorted(lengths, key=lambda sym: (lengths[sym], sym))
+    counts = [0] * (_HUFF_MAX_BITS + 1)
+    codes: dict[int, tuple[int, int]] = {}
+    code = 0
+    prev_len = lengths[symbols[0]] if symbols else 0
+    for sym in symbols:
+        code <<= lengths[sym] - prev_len
+        prev_len = lengths[sym]
+        codes[sym] = (code, prev_len)
+        counts[prev_len] += 1
+        code += 1
+    return counts, symbols, codes
+
+def _huffman_encode(hosts: list[bytes], codes: dict[int, tuple[int, int]]) -> tuple[bytes, list[int]]:
+    """Encode pool strings with a code from _huffman_code(), each starting on a byte; returns (packed, offsets)."""
+    packed = bytearray()
+    offsets = []
+    for host in hosts:
+        offsets.append(len(packed))
+        acc = 0
+        nbits = 0
+        for byte in host:
+            value, width = codes[byte]
+            acc = (acc << width) | value
+            nbits += width
+            while nbits >= 8:
+                nbits -= 8
+                packed.append((acc >> nbits) & 0xFF)
+        if nbits:
+            packed.append((acc << (8 - nbits)) & 0xFF)
+    return bytes(packed), offsets
+
+def _lay_out_pool(hosts: list[bytes], code_lengths: dict[int, int] | None) -> tuple[bytes, list[int]]:
+    """
+    Lay pool strings out as one blob: Huffman-coded with the canonical code of
+    code_lengths if given, else NUL-terminated. Returns (blob, host offsets).
+    """
+    if code_lengths is not None:
+        return _huffman_encode(hosts, _huffman_code(code_lengths)[2])
+    offsets = []
+    size = 0
+    for host in hosts:
+        offsets.append(size)
+        size += len(host) + 1
+    return b"".join(host + b"\0" for host in hosts), offsets
+
+def _pool_source(hosts: list[bytes], packed: bytes | None) -> str:
+    """Initializer of a pool, a byte list of the packed blob when compressed, else string literals."""
+    if packed is not None:
+        lines = ["  " + ", ".join(f"0x{b:02x}" for b in packed[i : i + 16]) + "," for i in range(0, len(packed), 16)]
+        return "\n".join(lines) or "  0x00,"
+    # Close the literal after each \0 so a following digit is not an octal escape
+    return "\n".join(f'  "{_cpp_escape_literal(host.decode("utf-8"))}\\0"' for host in hosts) or '  ""'
+
+# ------------------ Format Templates ------------------
+
+# "{name}" or "{name:.N}" (N decimals for floating point arguments), "{{" and "}}" are literal braces
+_PLACEHOLDER_RE = re.compile(rb"\{\{|\}\}|\{([A-Za-z_][A-Za-z0-9_]*)(?::\.([0-9]))?\}")
+# Segment marker for a literal run; as precision it means "shortest representation"
+_SEG_NONE = 0xFF
+
+def _is_template(text: str) -> bool:
+    """True if the text has at least one placeholder."""
+    return any(m.group(1) for m in _PLACEHOLDER_RE.finditer(text.encode("utf-8")))
+
+def _parse_template(text: str) -> list[tuple]:
+    """
+    Split a template into ("text", pos, len) byte runs of the translation and
+    ("arg", name, precision) slots.
+
+    Example:
+        "{n}% {{done}}" -> [("arg", "n", None), ("text", 3, 3), ("text", 7, 5)]
+    """
+    data = text.encode("utf-8")
+    segments: list[tuple] = []
+
+    def _literal(pos: int, length: int):
+        if length == 0:
+            return
+        if segments and segments[-1][0] == "text" and sum(segments[-1][1:]) == pos:
+            segments[-1] = ("text", segments[-1][1], segments[-1][2] + length)
+        else:
+            segments.append(("text", pos, length))
+
+    pos = 0
+    for m in _PLACEHOLDER_RE.finditer(data):
+        _literal(pos, m.start() - pos)
+        if m.group(1):
+            precision = int(m.group(2)) if m.group(2) else None
+            segments.append(("arg", m.group(1).decode("ascii"), precision))
+        else:
+            # Keep one brace of the escaped pair
+            _literal(m.start(), 1)
+        pos = m.end()
+    _literal(pos, len(data) - pos)
+    return segments
+
+def _format_templates(
+    locales_map: dict[str, dict[str, str]],
+    default_locale: str,
+    all_keys: list[str],
+    plurals: dict[str, list[str]] | None = None,
+) -> dict[str, list[str]]:
+    """
+    Find translations with placeholders and check every locale uses the same ones.
+
+    Plural forms share the arguments of their "other" form in the default
+    locale and may leave some of them out ("one device" next to "{n} devices").
+
+    Returns {key: argument names} with arguments in the order they first appear
+    in the default locale.
+    """
+    # Plural forms take their reference text from the plural key itself
+    reference_key = {}
+    for base, cats in (plurals or {}).items():
+        reference_key[base] = base
+        reference_key.update({f"{base}.{cat}": base for cat in cats})
+
+    def _slots(text: str) -> set[tuple]:
+        return {(seg[1], seg[2]) for seg in _parse_template(text) if seg[0] == "arg"}
+
+    templates = {}
+    for key in all_keys:
+        if not any(_is_template(kv[key]) for kv in locales_map.values() if key in kv):
+            continue
+        ref_text = locales_map[default_locale][reference_key.get(key, key)]
+        reference = _slots(ref_text)
+        used = {loc: _slots(kv[key]) for loc, kv in sorted(locales_map.items()) if key in kv}
+        if key in reference_key:
+            mismatch = any(not u <= reference for u in used.values())
+        else:
+            mismatch = any(u != reference for u in used.values())
+        if mismatch:
+            details = "; ".join(
+                f"{loc}: " + (", ".join(sorted(f"{{{n}}}" if p is None else f"{{{n}:.{p}}}" for n, p in u)) or "none")
+                for loc, u in used.items()
+            )
+            raise cv.Invalid(f"Placeholders of '{key}' differ between locales ({details})")
+        if any(len(kv[key].encode("utf-8")) > 0xFFFF for kv in locales_map.values() if key in kv):
+            raise cv.Invalid(f"Template '{key}' is too long, at most 65535 bytes are supported")
+        names = []
+        for seg in _parse_template(ref_text):
+            if seg[0] == "arg" and seg[1] not in names:
+                names.append(seg[1])
+        if len(names) >= _SEG_NONE:
+            raise cv.Invalid(f"Template '{key}' has too many placeholders")
+        templates[key] = names
+    return templates
+
+def _gen_format_tables(
+    locales_map: dict[str, dict[str, str]],
+    all_keys: list[str],
+    templates: dict[str, list[str]],
+    locales: list[str],
+    locale_symbols: list[str],
+    footprint: dict | None = None,
+) -> list[str]:
+    """
+    Generate segment tables for all templates and the i18n_format_internal() renderer.
+
+    If footprint is given, the flash size of the tables is added to it.
+    """
+    lines = []
+    key_ids = [i for i, k in enumerate(all_keys) if k in templates]
+
+    lines.append("// Append bytes to the output, counting what does not fit like snprintf")
+    lines.append("static void fmt_put(char* buf, size_t n, size_t* out, const char* s, size_t len) {")
+    lines.append("  if (buf && *out + 1 < n) {")
+    lines.append("    size_t room = n - 1 - *out;")
+    lines.append("    memcpy(buf + *out, s, len < room ? len : room);")
+    lines.append("  }")
+    lines.append("  *out += len;")
+    lines.append("}\n")
+
+    if key_ids:
+        lines.append("// Format template piece: a literal run of the translation or an argument slot")
+        lines.append("struct I18nSegment {")
+        lines.append("  uint16_t pos;  // Literal: byte offset into the translation")
+        lines.append(f"  uint8_t len;   // Literal: byte count, argument: decimals ({_SEG_NONE} for shortest)")
+        lines.append(f"  uint8_t arg;   // Argument index, {_SEG_NONE} for a literal")
+        lines.append("};\n")
+        lines.append("// Key IDs of translations with placeholders, sorted")
+        lines.append(f"static const uint16_t I18N_FMT_KEYS[{len(key_ids)}] PROGMEM = {{")
+        lines.append("  " + ", ".join(str(i) for i in key_ids))
+        lines.append("};")
+        lines.append(f"static constexpr size_t I18N_FMT_COUNT = {len(key_ids)};")
+        fmt_max = max(len(kv[all_keys[i]].encode("utf-8")) for kv in locales_map.values() for i in key_ids)
+        lines.append("// Longest template text, copied onto the stack where flash is not readable in place")
+        lines.append(f"static constexpr size_t I18N_FMT_MAX_LEN = {fmt_max};\n")
+        _count_table(footprint, 2 * len(key_ids), 2)
+
+        for loc, upper in zip(locales, locale_symbols):
+            elems = []
+            starts = [0]
+            for key in (all_keys[i] for i in key_ids):
+                for seg in _parse_template(locales_map[loc][key]):
+                    if seg[0] == "arg":
+                        precision = _SEG_NONE if seg[2] is None else seg[2]
+                        elems.append(f"{{0, {precision}, {templates[key].index(seg[1])}}}")
+                        continue
+                    # Literal runs longer than a segment can hold are split
+                    pos, length = seg[1], seg[2]
+                    while length > 0:
+                        chunk = min(length, 0xFF)
+                        elems.append(f"{{{pos}, {chunk}, {_SEG_NONE}}}")
+                        pos += chunk
+                        length -= chunk
+                starts.append(len(elems))
+            lines.append(f"// Locale: {loc} - segments of every template, and where each template starts")
+            lines.append(f"static const I18nSegment SEG_{upper}[] PROGMEM = {{")
+            lines.append("  " + (", ".join(elems) or "{0, 0, 0}"))
+            lines.append("};")
+            lines.append(f"static const uint16_t SEG_AT_{upper}[{len(starts)}] PROGMEM = {{")
+            lines.append("  " + ", ".join(str(i) for i in starts))
+            lines.append("};\n")
+            seg_bytes = 4 * max(len(elems), 1) + 2 * len(starts)
+            _count_table(footprint, seg_bytes, 2, 2)
+            if footprint is not None and not footprint["partition"]:
+                footprint["locales"][loc]["tables"] += seg_bytes
+
+        lines.append("struct I18nFormatData {")
+        lines.append("  const I18nSegment* segments;")
+        lines.append("  const uint16_t* starts;")
+        lines.append("};\n")
+        lines.append("// Format templates indexed by Locale")
+        lines.append("static const I18nFormatData FORMATS[] = {")
+        lines.append("  " + ",\n  ".join(f"{{SEG_{upper}, SEG_AT_{upper}}}" for upper in locale_symbols))
+        lines.append("};\n")
+        _count_table(footprint, len(locales) * 2 * _PTR_SIZE)
+        lines.append("// Find template index of a key ID, -1 if it has no placeholders")
+        lines.append("static int fmt_index_of(size_t key) {")
+        lines.append("  size_t lo = 0, hi = I18N_FMT_COUNT;")
+        lines.append("  while (lo < hi) {")
+        lines.append("    size_t mid = lo + (hi - lo) / 2;")
+        lines.append("    size_t id = pgm_read_word(&I18N_FMT_KEYS[mid]);")
+        lines.append("    if (id == key) return (int)mid;")
+        lines.append("    if (id < key) lo = mid + 1; else hi = mid;")
+        lines.append("  }")
+        lines.append("  return -1;")
+        lines.append("}\n")
+        lines.append("// Append one argument, integers without going through printf")
+        lines.append("static void fmt_put_arg(char* buf, size_t n, size_t* out, const FormatArg& arg, uint8_t precision) {")
+        lines.append("  char tmp[32];")
+        lines.append("  if (arg.type == FormatArg::STR) {")
+        lines.append("    const char* s = arg.s ? arg.s : \"\";")
+        lines.append("    fmt_put(buf, n, out, s, strlen(s));")
+        lines.append("  } else if (arg.type == FormatArg::FLOAT) {")
+        lines.append(f"    int r = precision == {_SEG_NONE} ? snprintf(tmp, sizeof(tmp), \"%g\", arg.f)")
+        lines.append("                              : snprintf(tmp, sizeof(tmp), \"%.*f\", (int)precision, arg.f);")
+        lines.append("    size_t len = r < 0 ? 0 : ((size_t)r < sizeof(tmp) ? (size_t)r : sizeof(tmp) - 1);")
+        lines.append("    fmt_put(buf, n, out, tmp, len);")
+        lines.append("  } else {")
+        lines.append("    bool neg = arg.type == FormatArg::INT && arg.i < 0;")
+        lines.append("    uint64_t v = arg.type == FormatArg::UINT ? arg.u : (neg ? 0 - (uint64_t)arg.i : (uint64_t)arg.i);")
+        lines.append("    char* p = tmp + sizeof(tmp);")
+        lines.append("    do {")
+        lines.append("      *--p = (char)('0' + v % 10);")
+        lines.append("      v /= 10;")
+        lines.append("    } while (v);")
+        lines.append("    if (neg) *--p = '-';")
+        lines.append("    fmt_put(buf, n, out, p, (size_t)(tmp + sizeof(tmp) - p));")
+        lines.append("  }")
+        lines.append("}\n")
+
+    lines.append("// Render a translation with its placeholders filled in (internal use).")
+    lines.append("// Returns the full length like snprintf; the output is truncated if it is >= n.")
+    lines.append("size_t i18n_format_internal(Locale loc, Key key, char* buf, size_t n, const FormatArg* args, size_t count) {")
+    if key_ids:
+        lines.append("  int fmt = fmt_index_of((size_t)key);")
+        lines.append("  // No placeholders - the translation is copied as is, straight into the caller's buffer")
+        lines.append("  if (fmt < 0) return i18n_get_buf_internal(loc, key, buf, n);\n")
+        lines.append("#if I18N_ZERO_COPY && !I18N_EXTERNAL_STORAGE")
+        lines.append("  size_t len = 0;")
+        lines.append("  const char* text = i18n_get_view_internal(loc, key, &len);")
+        lines.append("#else")
+        lines.append("  // A copy of our own, the shared view buffer could be overwritten by another task")
+        lines.append("  char text[I18N_FMT_MAX_LEN + 1];")
+        lines.append("  size_t len = i18n_get_buf_internal(loc, key, text, sizeof(text));")
+        lines.append("  if (len > I18N_FMT_MAX_LEN) len = I18N_FMT_MAX_LEN;")
+        lines.append("#endif")
+        lines.append("  size_t out = 0;")
+        lines.append("  const I18nFormatData& data = FORMATS[(size_t)loc < I18N_LOCALE_COUNT ? (size_t)loc : I18N_DEFAULT_LOCALE_INDEX];")
+        lines.append("  size_t last = pgm_read_word(&data.starts[fmt + 1]);")
+        lines.append("  for (size_t i = pgm_read_word(&data.starts[fmt]); i < last; ++i) {")
+        lines.append("    I18nSegment seg;")
+        lines.append("    memcpy_P(&seg, &data.segments[i], sizeof(seg));")
+        lines.append(f"    if (seg.arg == {_SEG_NONE}) {{")
+        lines.append("      if ((size_t)seg.pos + seg.len <= len) fmt_put(buf, n, &out, text + seg.pos, seg.len);")
+        lines.append("    } else if (seg.arg < count) {")
+        lines.append("      fmt_put_arg(buf, n, &out, args[seg.arg], seg.len);")
+        lines.append("    }")
+        lines.append("  }")
+        lines.append("  if (buf && n) buf[out < n ? out : n - 1] = '\\0';")
+        lines.append("  return out;")
+    else:
+        lines.append("  // No translation has placeholders, copy it straight into the caller's buffer")
+        lines.append("  (void)args;")
+        lines.append("  (void)count;")
+        lines.append("  return i18n_get_buf_internal(loc, key, buf, n);")
+    lines.append("}\n")
+    return lines
+
+# ------------------ Plural Rules ------------------
+
+# CLDR plural categories, in the order of the generated category indexes
+PLURAL_CATEGORIES = ["zero", "one", "two", "few", "many", "other"]
+
+# CLDR plural rules for integer counts: C++ expression over n, n10 = n % 10 and
+# n100 = n % 100, and the categories it can return besides "other"
+_PLURAL_RULES = {
+    "none": ("P_OTHER", []),
+    "one": ("n == 1 ? P_ONE : P_OTHER", ["one"]),
+    "zero_one": ("n <= 1 ? P_ONE : P_OTHER", ["one"]),
+    "romance": ("n == 1 ? P_ONE : (n % 1000000 == 0 && n != 0) ? P_MANY : P_OTHER", ["one", "many"]),
+    "french": ("n <= 1 ? P_ONE : (n % 1000000 == 0) ? P_MANY : P_OTHER", ["one", "many"]),
+    "east_slavic": (
+        "(n10 == 1 && n100 != 11) ? P_ONE : (n10 >= 2 && n10 <= 4 && (n100 < 12 || n100 > 14)) ? P_FEW : P_MANY",
+        ["one", "few", "many"],
+    ),
+    "polish": (
+        "n == 1 ? P_ONE : (n10 >= 2 && n10 <= 4 && (n100 < 12 || n100 > 14)) ? P_FEW : P_MANY",
+        ["one", "few", "many"],
+    ),
+    "west_slavic": ("n == 1 ? P_ONE : (n >= 2 && n <= 4) ? P_FEW : P_OTHER", ["one", "few"]),
+    "south_slavic": (
+        "(n10 == 1 && n100 != 11) ? P_ONE : (n10 >= 2 && n10 <= 4 && (n100 < 12 || n100 > 14)) ? P_FEW : P_OTHER",
+        ["one", "few"],
+    ),
+    "slovenian": ("n100 == 1 ? P_ONE : n100 == 2 ? P_TWO : (n100 == 3 || n100 == 4) ? P_FEW : P_OTHER", ["one", "two", "few"]),
+    "lithuanian": (
+        "(n100 >= 11 && n100 <= 19) ? P_OTHER : n10 == 1 ? P_ONE : n10 >= 2 ? P_FEW : P_OTHER",
+        ["one", "few"],
+    ),
+    "latvian": ("(n10 == 0 || (n100 >= 11 && n100 <= 19)) ? P_ZERO : (n10 == 1 && n100 != 11) ? P_ONE : P_OTHER", ["zero", "one"]),
+    "romanian": ("n == 1 ? P_ONE : (n == 0 || (n100 >= 1 && n100 <= 19)) ? P_FEW : P_OTHER", ["one", "few"]),
+    "icelandic": ("(n10 == 1 && n100 != 11) ? P_ONE : P_OTHER", ["one"]),
+    "hebrew": ("n == 1 ? P_ONE : n == 2 ? P_TWO : P_OTHER", ["one", "two"]),
+    "arabic": (
+        "n == 0 ? P_ZERO : n == 1 ? P_ONE : n == 2 ? P_TWO : (n100 >= 3 && n100 <= 10) ? P_FEW : n100 >= 11 ? P_MANY : P_OTHER",
+        ["zero", "one", "two", "few", "many"],
+    ),
+    "irish": ("n == 1 ? P_ONE : n == 2 ? P_TWO : (n >= 3 && n <= 6) ? P_FEW : (n >= 7 && n <= 10) ? P_MANY : P_OTHER", ["one", "two", "few", "many"]),
+    "welsh": ("n == 0 ? P_ZERO : n == 1 ? P_ONE : n == 2 ? P_TWO : n == 3 ? P_FEW : n == 6 ? P_MANY : P_OTHER", ["zero", "one", "two", "few", "many"]),
+}
+
+# Language (or full locale code) -> rule, languages not listed use "one"
+_PLURAL_LANGUAGES = {
+    **dict.fromkeys(["ja", "zh", "ko", "th", "vi", "id", "ms", "lo", "my", "km", "yue"], "none"),
+    **dict.fromkeys(["hi", "bn", "fa", "gu", "kn", "zu", "am", "as"], "zero_one"),
+    **dict.fromkeys(["es", "it", "ca", "pt-pt", "pt_pt"], "romance"),
+    **dict.fromkeys(["fr", "pt"], "french"),
+    **dict.fromkeys(["ru", "uk", "be"], "east_slavic"),
+    "pl": "polish",
+    **dict.fromkeys(["cs", "sk"], "west_slavic"),
+    **dict.fromkeys(["hr", "sr", "bs"], "south_slavic"),
+    "sl": "slovenian",
+    "lt": "lithuanian",
+    "lv": "latvian",
+    **dict.fromkeys(["ro", "mo"], "romanian"),
+    **dict.fromkeys(["is", "mk"], "icelandic"),
+    "he": "hebrew",
+    "ar": "arabic",
+    "ga": "irish",
+    "cy": "welsh",
+}
+
+def _plural_rule_for(locale: str) -> tuple[str, list[str]]:
+    """Plural rule name and the categories it yields besides "other", for a locale code."""
+    code = locale.lower()
+    name = _PLURAL_LANGUAGES.get(code) or _PLURAL_LANGUAGES.get(re.split(r"[-_]", code)[0], "one")
+    return name, _PLURAL_RULES[name][1]
+
+def _gen_plural_rules(
+    all_keys: list[str], plurals: dict[str, list[str]], locales: list[str], footprint: dict | None = None
+) -> list[str]:
+    """
+    Generate the per-locale plural selectors and i18n_plural_key_internal().
+
+    If footprint is given, the flash size of the tables is added to it.
+    """
+    lines = []
+    lines.append("// Plural form of a key for a count (internal use)")
+    if not plurals:
+        lines.append("Key i18n_plural_key_internal(Locale loc, Key key, uint32_t n) {")
+        lines.append("  // No translation has plural forms")
+        lines.append("  (void)loc;")
+        lines.append("  (void)n;")
+        lines.append("  return key;")
+        lines.append("}\n")
+        return lines
+
+    key_index = {k: i for i, k in enumerate(all_keys)}
+    rules = [_plural_rule_for(loc)[0] for loc in locales]
+
+    body = []
+    body.append("// CLDR plural categories, index into a row of I18N_PLURAL_FORMS")
+    body.append("enum : uint8_t { " + ", ".join(f"P_{c.upper()}" for c in PLURAL_CATEGORIES) + " };\n")
+    body.append("// Plural category of a count, one selector per rule (CLDR rules for integers)")
+    for name in sorted(set(rules)):
+        expr = _PLURAL_RULES[name][0]
+        body.append(f"static uint8_t plural_{name}(uint32_t n) {{")
+        if "n10" in expr:
+            body.append("  uint32_t n10 = n % 10;")
+        if "n100" in expr:
+            body.append("  uint32_t n100 = n % 100;")
+        if not re.search(r"\bn\b", expr):
+            body.append("  (void)n;")
+        body.append(f"  return {expr};")
+        body.append("}")
+    body.append("")
+    body.append("// Plural selector of each locale, indexed by Locale")
+    body.append("static uint8_t (*const PLURAL_RULES[])(uint32_t) = {" + ", ".join(f"plural_{r}" for r in rules) + "};\n")
+
+    bases = sorted(plurals, key=lambda b: key_index[b])
+    slot_type, slot_read = _uint_type_for(len(bases))
+    slots = [0] * len(all_keys)
+    for row, b in enumerate(bases):
+        slots[key_index[b]] = row + 1
+    body.append("// Row of I18N_PLURAL_FORMS + 1 for each key ID, 0 for keys without plural forms")
+    body.append(f"static const {slot_type} I18N_PLURAL_SLOT[{len(all_keys)}] PROGMEM = {{")
+    body.append("  " + ", ".join(str(v) for v in slots))
+    body.append("};")
+    body.append("// Key ID of the form for each category")
+    body.append(f"static const uint16_t I18N_PLURAL_FORMS[{len(bases)}][{len(PLURAL_CATEGORIES)}] PROGMEM = {{")
+    rows = []
+    for b in bases:
+        forms = [key_index[f"{b}.{c}"] if c in plurals[b] else key_index[b] for c in PLURAL_CATEGORIES]
+        rows.append("  {" + ", ".join(str(f) for f in forms) + "}")
+    body.append(",\n".join(rows))
+    body.append("};\n")
+    lines[:0] = body
+    slot_size = _UINT_SIZES[slot_type]
+    _count_table(footprint, len(locales) * _PTR_SIZE)
+    _count_table(footprint, slot_size * len(all_keys), slot_size)
+    _count_table(footprint, 2 * len(bases) * len(PLURAL_CATEGORIES), 2)
+
+    lines.append("Key i18n_plural_key_internal(Locale loc, Key key, uint32_t n) {")
+    lines.append("  if ((size_t)key >= I18N_KEYS_COUNT) return key;")
+    lines.append(f"  size_t slot = {slot_read}(&I18N_PLURAL_SLOT[(size_t)key]);")
+    lines.append("  if (slot) {")
+    lines.append("    size_t li = (size_t)loc < I18N_LOCALE_COUNT ? (size_t)loc : I18N_DEFAULT_LOCALE_INDEX;")
+    lines.append("    return (Key)pgm_read_word(&I18N_PLURAL_FORMS[slot - 1][PLURAL_RULES[li](n)]);")
+    lines.append("  }")
+    lines.append("  return key;  // No plural forms")
+    lines.append("}\n")
+    return lines
+
+# ------------------ Locale Blobs ------------------
+
+# Layout shared with the loader emitted by _gen_partition_storage(), all little-endian:
+#   image header:   "I18P", u8 version, u8 locale count, u16 reserved, u32 keys hash
+#   directory:      per locale char code[_PART_CODE_LEN], u32 blob offset, u32 blob size
+#   locale blob:    "I18L", u8 version, u8 offset size, u8 length size, u8 reserved,
+#                   u32 keys hash, u32 key count, u32 string bytes, u32 longest string,
+#                   then offsets[key count], lengths[key count] and the string pool
+_BLOB_VERSION = 2
+_IMAGE_HEADER = struct.Struct("<4sBBHI")
+_IMAGE_ENTRY = struct.Struct(f"<{_PART_CODE_LEN}sII")
+_BLOB_HEADER = struct.Struct("<4sBBBBIIII")
+_UINT_SIZES = {"uint8_t": 1, "uint16_t": 2, "uint32_t": 4}
+
+def _keys_hash(locales_map: dict[str, dict[str, str]], all_keys: list[str]) -> int:
+    """
+    Fingerprint of the key list, blobs are only valid for firmware with the same keys.
+
+    Template segments are compiled into the firmware and point into the text, so
+    the texts of templates are part of the fingerprint too.
+    """
+    parts = [k.encode("utf-8") for k in all_keys]
+    for loc, kv in sorted(locales_map.items()):
+        parts.extend(f"{loc}:{k}={v}".encode("utf-8") for k, v in sorted(kv.items()) if _is_template(v))
+    return _ph_hash(b"\0".join(parts), 0)
+
+def _layout_hash(all_keys: list[str], locales: list[str]) -> int:
+    """Fingerprint of what Key and Locale IDs refer to, for data kept across firmware updates."""
+    return _ph_hash(b"\0".join(k.encode("utf-8") for k in all_keys) + b"\1" + ",".join(locales).encode("utf-8"), 0)
+
+# Pointer size of the targets, for the size of tables of pointers
+_PTR_SIZE = 4
+
+
+def _footprint_totals(fp: dict) -> int:
+    """
+    Firmware flash bytes of a footprint filled by _gen_translations_cpp():
+    strings (pool after dedup/compression), tables (offsets and lengths per
+    locale, the locale codes and hashes, and the key lookup, format and plural
+    tables), padding (alignment, an upper bound) and keys (key names); saved is
+    what deduplication and compression took off the plain strings, partition the
+    size of the locale blobs. locales has text and tables bytes per locale.
+    """
+    return fp["strings"] + fp["tables"] + fp["padding"] + fp["keys"]
+
+def _log_footprint(fp: dict) -> None:
+    """Log the flash cost of every locale and of the whole catalog."""
+    for loc, sizes in sorted(fp["locales"].items()):
+        _LOGGER.info(
+            "i18n locale %s: %d bytes of text, %d bytes of %s", loc, sizes["text"], sizes["tables"],
+            "partition blob" if fp["partition"] else "tables",
+        )
+    _LOGGER.info(
+        "i18n footprint: %d bytes of flash (strings %d, tables %d, alignment up to %d, keys %d), "
+        "%d bytes saved by deduplication and compression%s",
+        _footprint_totals(fp), fp["strings"], fp["tables"], fp["padding"], fp["keys"], fp["saved"],
+        f", {fp['partition']} bytes on the data partition" if fp["partition"] else "",
+    )
+
+def _count_table(footprint: dict | None, size: int, align: int = 1, count: int = 1) -> None:
+    """Add count flash tables of size bytes in all to footprint, with the padding their alignment may need."""
+    if footprint is not None:
+        footprint["tables"] += size
+        footprint["padding"] += count * (align - 1)
+
+def _check_string_length(locales_map: dict[str, dict[str, str]], limit: int) -> None:
+    """Fail the build on translations longer than limit bytes."""
+    too_long = sorted(
+        (len(text.encode("utf-8")), loc, key)
+        for loc, kv in locales_map.items()
+        for key, text in kv.items()
+        if len(text.encode("utf-8")) > limit
+    )
+    if too_long:
+        shown = ", ".join(f"{loc}:{key} ({n} bytes)" for n, loc, key in reversed(too_long[-5:]))
+        more = f" and {len(too_long) - 5} more" if len(too_long) > 5 else ""
+        raise cv.Invalid(f"Translations longer than max_string_length={limit} bytes: {shown}{more}")
+
+def _locale_hash(all_keys: list[str], flat: dict[str, str]) -> int:
+    """Fingerprint of one locale's catalog, the ETag of the web_server catalog."""
+    return _ph_hash(b"\0".join(f"{k}\1{flat[k]}".encode("utf-8") for k in all_keys), 0)
+
+def _build_locale_blob(texts: list[str], keys_hash: int) -> bytes:
+    """Pack one locale's strings (in key order) into the offset-table blob format."""
+    hosts, refs = _build_string_pool(texts)
+    host_offsets = []
+    pool = bytearray()
+    for host in hosts:
+        host_offsets.append(len(pool))
+        pool += host + b"\0"
+
+    lengths = [len(t.encode("utf-8")) for t in texts]
+    offsets = [host_offsets[refs[t][0]] + refs[t][1] for t in texts]
+    off_size = _UINT_SIZES[_uint_type_for(len(pool))[0]]
+    len_size = _UINT_SIZES[_uint_type_for(max(lengths, default=0))[0]]
+
+    def _pack(values, size):
+        return b"".join(v.to_bytes(size, "little") for v in values)
+
+    header = _BLOB_HEADER.pack(
+        b"I18L", _BLOB_VERSION, off_size, len_size, 0, keys_hash, len(texts), len(pool), max(lengths, default=0)
+    )
+    return header + _pack(offsets, off_size) + _pack(lengths, len_size) + bytes(pool)
+
+class _PartitionImage:
+    """
+    Image for the data partition, written blob by blob behind a directory that
+    is filled in at the end, so the image is never held in memory. Used as a
+    context manager; the file is only replaced if its content changed.
+    """
+
+    def __init__(self, path: Path, locales: list[str], keys_hash: int):
+        for loc in locales:
+            if len(loc.encode("utf-8")) >= _PART_CODE_LEN:
+                raise cv.Invalid(
+                    f"Locale code '{loc}' is too long for storage: partition (max {_PART_CODE_LEN - 1} bytes)"
+                )
+        self.path = path
+        self.tmp = path.with_name(path.name + ".tmp")
+        self.count = len(locales)
+        self.keys_hash = keys_hash
+        self.entries: list[bytes] = []
+        self.size = 0
+
+    def __enter__(self):
+        self.path.parent.mkdir(parents=True, exist_ok=True)
+        self.file = open(self.tmp, "wb")
+        self.file.write(bytes(_IMAGE_HEADER.size + _IMAGE_ENTRY.size * self.count))
+        return self
+
+    def add(self, loc: str, blob: bytes) -> None:
+        # Keep blobs word-aligned so the mapped tables are cheap to read
+        self.file.write(bytes(-self.file.tell() % 4))
+        self.entries.append(_IMAGE_ENTRY.pack(loc.encode("utf-8"), self.file.tell(), len(blob)))
+        self.file.write(blob)
+
+    def __exit__(self, exc_type, exc, tb):
+        if exc_type is None:
+            self.size = self.file.tell()
+            self.file.seek(0)
+            self.file.write(_IMAGE_HEADER.pack(b"I18P", _BLOB_VERSION, self.count, 0, self.keys_hash))
+            self.file.write(b"".join(self.entries))
+        self.file.close()
+        if exc_type is not None or (self.path.is_file() and filecmp.cmp(self.tmp, self.path, shallow=False)):
+            self.tmp.unlink()
+        else:
+            os.replace(self.tmp, self.path)
+        return False
+
+# ------------------ Perfect Hash Builder ------------------
+
+# Keys per bucket in the hash-and-displace scheme (the CHD "lambda")
+_PH_BUCKET_SIZE = 4
+_PH_MAX_DISPLACEMENT = 0xFFFF
+
+def _ph_hash(data: bytes, seed: int) -> int:
+    """
+    Seeded FNV-1a with a murmur3 finalizer.
+
+    Must match i18n_hash() emitted into translations.cpp bit for bit.
+    """
+    h = (2166136261 ^ (seed * 0x9E3779B9)) & 0xFFFFFFFF
+    for b in data:
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h
+
+def _build_perfect_hash(all_keys: list[str]):
+    """
+    Build a minimal perfect hash (hash-and-displace, CHD style) over all keys.
+
+    Returns (displacements, slots): a key lands in bucket ph(key, 0) % len(displacements),
+    its slot is ph(key, displacements[bucket]) % len(slots) and slots[slot] is its key index.
+    Returns None if no displacement set was found.
+    """
+    n = len(all_keys)
+    encoded = [k.encode("utf-8") for k in all_keys]
+    bucket_count = max(1, (n + _PH_BUCKET_SIZE - 1) // _PH_BUCKET_SIZE)
+    buckets: list[list[int]] = [[] for _ in range(bucket_count)]
+    for idx, data in enumerate(encoded):
+        buckets[_ph_hash(data, 0) % bucket_count].append(idx)
+
+    displacements = [0] * bucket_count
+    slots = [-1] * n
+    # Place the largest buckets first while the slot table is still sparse
+    for b in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        members = buckets[b]
+        if not members:
+            break
+        for d in range(1, _PH_MAX_DISPLACEMENT + 1):
+            candidate = [_ph_hash(encoded[idx], d) % n for idx in members]
+            if len(set(candidate)) == len(candidate) and all(slots[c] < 0 for c in candidate):
+                for idx, c in zip(members, candidate):
+                    slots[c] = idx
+                displacements[b] = d
+                break
+        else:
+            return None
+    return displacements, slots
+
+def _gen_key_lookup(all_keys: list[str], strategy: str, footprint: dict | None = None) -> list[str]:
+    """
+    Generate key_index_of() for the selected lookup strategy.
+
+    If footprint is given, the flash size of the perfect hash tables is added to it.
+    """
+    lines = []
+    if strategy == "perfect_hash":
+        ph = _build_perfect_hash(all_keys)
+        if ph is None:
+            _LOGGER.warning("Could not build a perfect hash over %d keys, falling back to binary search", len(all_keys))
+            strategy = "binary"
+
+    if strategy == "perfect_hash":
+        displacements, slots = ph
+        _count_table(footprint, 2 * len(displacements), 2)
+        _count_table(footprint, 2 * len(slots), 2)
+        lines.append("// Seeded FNV-1a with murmur3 finalizer (must match _ph_hash() in the generator)")
+        lines.append("static uint32_t i18n_hash(const char* s, uint32_t seed) {")
+        lines.append("  uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);")
+        lines.append("  while (*s) {")
+        lines.append("    h ^= (uint8_t)*s++;")
+        lines.append("    h *= 16777619u;")
+        lines.append("  }")
+        lines.append("  h ^= h >> 16;")
+        lines.append("  h *= 0x85EBCA6Bu;")
+        lines.append("  h ^= h >> 13;")
+        lines.append("  h *= 0xC2B2AE35u;")
+        lines.append("  h ^= h >> 16;")
+        lines.append("  return h;")
+        lines.append("}\n")
+        lines.append("// Minimal perfect hash: bucket displacements and slot -> key index")
+        lines.append(f"static const uint16_t I18N_PH_DISP[{len(displacements)}] PROGMEM = {{")
+        lines.append("  " + ", ".join(str(d) for d in displacements))
+        lines.append("};")
+        lines.append(f"static const uint16_t I18N_PH_SLOTS[{len(slots)}] PROGMEM = {{")
+        lines.append("  " + ", ".join(str(i) for i in slots))
+        lines.append("};\n")
+        lines.append("// Find index of translation key: one hash probe plus a verifying strcmp")
+        lines.append("static int key_index_of(const char* key) {")
+        lines.append(f"  uint16_t d = pgm_read_word(&I18N_PH_DISP[i18n_hash(key, 0) % {len(displacements)}u]);")
+        lines.append(f"  uint16_t idx = pgm_read_word(&I18N_PH_SLOTS[i18n_hash(key, d) % {len(slots)}u]);")
+        lines.append("  if (strcmp(I18N_KEYS[idx], key) == 0) return (int)idx;")
+        lines.append("  return -1;  // Key not found")
+        lines.append("}\n")
+    elif strategy == "binary":
+        lines.append("// Find index of translation key: binary search over the sorted master list")
+        lines.append("static int key_index_of(const char* key) {")
+        lines.append("  size_t lo = 0, hi = I18N_KEYS_COUNT;")
+        lines.append("  while (lo < hi) {")
+        lines.append("    size_t mid = lo + (hi - lo) / 2;")
+        lines.append("    int cmp = strcmp(I18N_KEYS[mid], key);")
+        lines.append("    if (cmp == 0) return (int)mid;")
+        lines.append("    if (cmp < 0) lo = mid + 1; else hi = mid;")
+        lines.append("  }")
+        lines.append("  return -1;  // Key not found")
+        lines.append("}\n")
+    else:
+        lines.append("// Find index of translation key in master list")
+        lines.append("static int key_index_of(const char* key) {")
+        lines.append("  for (size_t i = 0; i < I18N_KEYS_COUNT; ++i) {")
+        lines.append("    if (strcmp(I18N_KEYS[i], key) == 0) return (int)i;")
+        lines.append("  }")
+        lines.append("  return -1;  // Key not found")
+        lines.append("}\n")
+    return lines
+
+def _gen_partition_storage(
+    locales_map: dict[str, dict[str, str]], all_keys: list[str], label: str, statistics: bool = False
+) -> list[str]:
+    """
+    Generate the loader for locale blobs on a data partition (see _build_partition_image()).
+
+    The directory is read once; a locale is mapped with esp_partition_mmap() when it
+    is first selected or a handle for it is made and stays mapped, other locales
+    are streamed with esp_partition_read().
+    """
+    lines = []
+    lines.append(f'// Locale blobs on the "{_cpp_escape_literal(label)}" data partition')
+    lines.append(f"static constexpr uint32_t I18N_KEYS_HASH = 0x{_keys_hash(locales_map, all_keys):08X}u;")
+    lines.append(f"static constexpr uint8_t I18N_BLOB_VERSION = {_BLOB_VERSION};")
+    lines.append(f"static constexpr size_t I18N_IMAGE_HEADER_SIZE = {_IMAGE_HEADER.size};")
+    lines.append(f"static constexpr size_t I18N_IMAGE_ENTRY_SIZE = {_IMAGE_ENTRY.size};")
+    lines.append(f"static constexpr size_t I18N_BLOB_HEADER_SIZE = {_BLOB_HEADER.size};")
+    lines.append(f"static constexpr size_t I18N_CODE_LEN = {_PART_CODE_LEN};\n")
+    lines.append("// Position of one locale blob in the partition, found once from the directory")
+    lines.append("struct I18nBlobRef {")
+    lines.append("  uint32_t tables;     // Partition offset of the offset table, 0 if the locale is missing")
+    lines.append("  uint32_t strings;    // Partition offset of the string pool")
+    lines.append("  uint32_t pool_size;  // String pool bytes")
+    lines.append("  uint8_t off_size;")
+    lines.append("  uint8_t len_size;")
+    lines.append("};\n")
+    lines.append("static const esp_partition_t* partition = nullptr;")
+    lines.append("static I18nBlobRef blobs[I18N_LOCALE_COUNT];")
+    lines.append("static bool directory_read = false;")
+    lines.append("// Set once blobs[] and partition are filled in, readers on other tasks check it first")
+    lines.append("static std::atomic<bool> directory_ready{false};\n")
+    lines.append("// Tables of each locale blob once mapped. A mapping is never released, so views into it")
+    lines.append("// stay valid; only locales that were selected take MMU pages")
+    lines.append("static std::atomic<const uint8_t*> mapped[I18N_LOCALE_COUNT] = {};\n")
+    lines.append("// Read a little-endian unsigned integer of 1, 2 or 4 bytes")
+    lines.append("static uint32_t read_le(const uint8_t* p, uint8_t size) {")
+    lines.append("  uint32_t v = 0;")
+    lines.append("  for (uint8_t i = size; i > 0; --i) v = (v << 8) | p[i - 1];")
+    lines.append("  return v;")
+    lines.append("}\n")
+    lines.append("static bool valid_int_size(uint8_t size) { return size == 1 || size == 2 || size == 4; }\n")
+    lines.append("// Locate the locale blobs and check they were built for this key list, once (locale switches only)")
+    lines.append("static bool read_directory() {")
+    lines.append("  if (directory_read) return partition != nullptr;")
+    lines.append("  directory_read = true;")
+    lines.append("  const esp_partition_t* part = esp_partition_find_first(")
+    lines.append(f'      ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "{_cpp_escape_literal(label)}");')
+    lines.append("  uint8_t head[I18N_IMAGE_HEADER_SIZE];")
+    lines.append("  if (!part || esp_partition_read(part, 0, head, sizeof(head)) != ESP_OK) return false;")
+    lines.append("  if (memcmp(head, \"I18P\", 4) != 0 || head[4] != I18N_BLOB_VERSION || read_le(head + 8, 4) != I18N_KEYS_HASH)")
+    lines.append("    return false;\n")
+    lines.append("  for (size_t i = 0; i < head[5]; ++i) {")
+    lines.append("    uint8_t entry[I18N_IMAGE_ENTRY_SIZE];")
+    lines.append("    size_t at = I18N_IMAGE_HEADER_SIZE + i * I18N_IMAGE_ENTRY_SIZE;")
+    lines.append("    if (esp_partition_read(part, at, entry, sizeof(entry)) != ESP_OK) return false;")
+    lines.append("    char code[I18N_CODE_LEN + 1] = {};")
+    lines.append("    memcpy(code, entry, I18N_CODE_LEN);")
+    lines.append("    int loc = i18n_locale_index_internal(code);")
+    lines.append("    uint32_t offset = read_le(entry + I18N_CODE_LEN, 4);")
+    lines.append("    uint32_t size = read_le(entry + I18N_CODE_LEN + 4, 4);")
+    lines.append("    // Skip locales this firmware does not know, blobs that do not fit and blobs with")
+    lines.append("    // strings longer than the buffers of this firmware")
+    lines.append("    if (loc < 0 || offset > part->size || size > part->size - offset || size < I18N_BLOB_HEADER_SIZE)")
+    lines.append("      continue;\n")
+    lines.append("    uint8_t blob[I18N_BLOB_HEADER_SIZE];")
+    lines.append("    if (esp_partition_read(part, offset, blob, sizeof(blob)) != ESP_OK) continue;")
+    lines.append("    uint8_t off_size = blob[5], len_size = blob[6];")
+    lines.append("    if (memcmp(blob, \"I18L\", 4) != 0 || blob[4] != I18N_BLOB_VERSION || !valid_int_size(off_size) ||")
+    lines.append("        !valid_int_size(len_size) || read_le(blob + 8, 4) != I18N_KEYS_HASH ||")
+    lines.append("        read_le(blob + 12, 4) != I18N_KEYS_COUNT || read_le(blob + 20, 4) > I18N_MAX_LEN)")
+    lines.append("      continue;")
+    lines.append("    uint32_t table_size = I18N_KEYS_COUNT * (off_size + len_size);")
+    lines.append("    uint32_t pool_size = read_le(blob + 16, 4);")
+    lines.append("    if (pool_size == 0 || I18N_BLOB_HEADER_SIZE + table_size + pool_size > size) continue;")
+    lines.append("    uint32_t tables = offset + I18N_BLOB_HEADER_SIZE;")
+    lines.append("    blobs[loc] = I18nBlobRef{tables, tables + table_size, pool_size, off_size, len_size};")
+    lines.append("  }")
+    lines.append("  partition = part;")
+    lines.append("  directory_ready.store(true, std::memory_order_release);")
+    lines.append("  return true;")
+    lines.append("}\n")
+    lines.append("// Map the blob of a locale, once (locale switches only)")
+    lines.append("static bool map_locale(size_t loc) {")
+    lines.append("  if (mapped[loc].load(std::memory_order_relaxed)) return true;")
+    lines.append("  if (!read_directory() || blobs[loc].tables == 0) return false;")
+    lines.append("  const I18nBlobRef& ref = blobs[loc];")
+    lines.append("  const void* ptr = nullptr;")
+    lines.append("  esp_partition_mmap_handle_t handle;")
+    lines.append("  if (esp_partition_mmap(partition, ref.tables, ref.strings + ref.pool_size - ref.tables, ESP_PARTITION_MMAP_DATA,")
+    lines.append("                         &ptr, &handle) != ESP_OK)")
+    lines.append("    return false;")
+    lines.append("  mapped[loc].store((const uint8_t*)ptr, std::memory_order_release);")
+    lines.append("  return true;")
+    lines.append("}\n")
+    lines.append("// Map a locale without selecting it, for handles (internal use, main loop only)")
+    lines.append("bool i18n_map_locale_internal(Locale loc) {")
+    lines.append("  return (size_t)loc < I18N_LOCALE_COUNT && map_locale((size_t)loc);")
+    lines.append("}\n")
+    lines.append("// Offset into the string pool and length of a translation, from the mapped tables t or streamed")
+    lines.append("static bool locate(const uint8_t* t, size_t loc, size_t idx, uint32_t* off, size_t* len) {")
+    lines.append("  if (!directory_ready.load(std::memory_order_acquire) || blobs[loc].tables == 0) return false;")
+    lines.append("  const I18nBlobRef& ref = blobs[loc];")
+    lines.append("  uint32_t len_at = I18N_KEYS_COUNT * ref.off_size + idx * ref.len_size;")
+    lines.append("  uint8_t raw[8];")
+    lines.append("  const uint8_t* o = raw;")
+    lines.append("  const uint8_t* l = raw + 4;")
+    lines.append("  if (t) {")
+    lines.append("    o = t + idx * ref.off_size;")
+    lines.append("    l = t + len_at;")
+    lines.append("  } else if (esp_partition_read(partition, ref.tables + idx * ref.off_size, raw, ref.off_size) != ESP_OK ||")
+    lines.append("             esp_partition_read(partition, ref.tables + len_at, raw + 4, ref.len_size) != ESP_OK) {")
+    lines.append("    return false;")
+    lines.append("  }")
+    lines.append("  *off = read_le(o, ref.off_size);")
+    lines.append("  *len = read_le(l, ref.len_size);")
+    lines.append("  // The string and its terminator must lie inside the pool and fit the buffers of this firmware")
+    lines.append("  return *off < ref.pool_size && *len < ref.pool_size - *off && *len <= I18N_MAX_LEN;")
+    lines.append("}\n")
+    lines.append("// String pool of a mapped locale")
+    lines.append("static const char* mapped_strings(const uint8_t* t, size_t loc) {")
+    lines.append("  return (const char*)t + (blobs[loc].strings - blobs[loc].tables);")
+    lines.append("}\n")
+    lines.append("// Copy translation into buffer (internal use).")
+    lines.append("// Returns the full length like snprintf; the copy is truncated if it is >= n.")
+    lines.append("size_t i18n_get_buf_internal(Locale loc, Key key, char* buf, size_t n) {")
+    lines.append("  size_t idx = (size_t)key;")
+    if statistics:
+        lines.append("  I18nLookupTimer timer(key, buf != nullptr);")
+    lines.append("  size_t li = (size_t)loc < I18N_LOCALE_COUNT ? (size_t)loc : I18N_DEFAULT_LOCALE_INDEX;")
+    lines.append("  const uint8_t* t = mapped[li].load(std::memory_order_acquire);")
+    lines.append("  uint32_t off = 0;")
+    lines.append("  size_t len = 0;")
+    lines.append("  if (idx >= I18N_KEYS_COUNT || !locate(t, li, idx, &off, &len)) {")
+    lines.append("    if (buf && n) buf[0] = '\\0';")
+    lines.append("    return 0;")
+    lines.append("  }")
+    lines.append("  if (!buf || n == 0) return len;\n")
+    lines.append("  size_t copy = len < n ? len : n - 1;")
+    lines.append("  if (t) {")
+    lines.append("    memcpy(buf, mapped_strings(t, li) + off, copy);")
+    lines.append("  } else if (esp_partition_read(partition, blobs[li].strings + off, buf, copy) != ESP_OK) {")
+    lines.append("    copy = 0;")
+    lines.append("  }")
+    lines.append("  buf[copy] = '\\0';")
+    lines.append("  return len;")
+    lines.append("}\n")
+    lines.append("// Locales never selected are streamed from the partition into a buffer of the calling task")
+    lines.append("static thread_local char view_buf[I18N_MAX_LEN + 1];\n")
+    lines.append("// Get pointer to translation in the mapped partition (internal use)")
+    lines.append("const char* i18n_get_view_internal(Locale loc, Key key, size_t* len) {")
+    lines.append("  size_t idx = (size_t)key;")
+    lines.append("  size_t li = (size_t)loc < I18N_LOCALE_COUNT ? (size_t)loc : I18N_DEFAULT_LOCALE_INDEX;")
+    lines.append("  const uint8_t* t = mapped[li].load(std::memory_order_acquire);")
+    lines.append("  if (idx < I18N_KEYS_COUNT && t) {")
+    if statistics:
+        lines.append("    I18nLookupTimer timer(key, true);")
+    lines.append("    uint32_t off = 0;")
+    lines.append("    size_t full = 0;")
+    lines.append("    if (locate(t, li, idx, &off, &full)) {")
+    lines.append("      if (len) *len = full;")
+    lines.append("      return mapped_strings(t, li) + off;")
+    lines.append("    }")
+    lines.append("  }")
+    lines.append("  size_t full = i18n_get_buf_internal(loc, key, view_buf, sizeof(view_buf));")
+    lines.append("  if (len) *len = full < sizeof(view_buf) ? full : sizeof(view_buf) - 1;")
+    lines.append("  return view_buf;")
+    lines.append("}\n")
+    lines.append("// Pointers into the mapped partition for many keys, 0 if the locale is not mapped (internal use)")
+    lines.append("size_t i18n_get_views_internal(Locale loc, const Key* keys, const char** out, size_t n) {")
+    lines.append("  size_t li = (size_t)loc < I18N_LOCALE_COUNT ? (size_t)loc : I18N_DEFAULT_LOCALE_INDEX;")
+    lines.append("  const uint8_t* t = mapped[li].load(std::memory_order_acquire);")
+    lines.append("  if (!t) return 0;")
+    lines.append("  for (size_t i = 0; i < n; ++i) {")
+    if statistics:
+        lines.append("    I18nLookupTimer timer(keys[i], true);")
+    lines.append("    uint32_t off = 0;")
+    lines.append("    size_t full = 0;")
+    lines.append("    out[i] = (size_t)keys[i] < I18N_KEYS_COUNT && locate(t, li, (size_t)keys[i], &off, &full) ? mapped_strings(t, li) + off : \"\";")
+    lines.append("  }")
+    lines.append("  return n;")
+    lines.append("}")
+    return lines
+
 # ------------------ Generate translations.h ------------------
 
-def _gen_translations_h(all_keys: list[str]) -> str:
+def _max_string_len(locales_map: dict[str, dict[str, str]]) -> int:
+    """Length in UTF-8 bytes of the longest translated string."""
+    return max((len(v.encode("utf-8")) for kv in locales_map.values() for v in kv.values()), default=0)
+
+def _gen_translations_h(
+    all_keys: list[str],
+    max_len: int,
+    locales: list[str],
+    default_locale: str,
+    compression: str = "none",
+    partition: str | None = None,
+    templates: dict[str, list[str]] | None = None,
+    statistics: bool = False,
+) -> str:
     """Generate C++ header file with translation function declarations."""
+    key_symbols = _key_symbols(all_keys)
+    templates = templates or {}
+    # Templates list their format() arguments next to the key ID
+    enum_elems = "".join(
+        f"  {sym} = {i},"
+        + (f"  // {', '.join(f'{{{n}}}' for n in templates[key])}" if key in templates else "")
+        + "\n"
+        for i, (key, sym) in enumerate(zip(all_keys, key_symbols))
+    )
+    locale_elems = "".join(f"  {sym} = {i},\n" for i, sym in enumerate(_locale_symbols(locales)))
     return (
         "#pragma once\n"
         "#include <stddef.h>\n"
-        "#include <stdint.h>\n\n"
+        "#include <stdint.h>\n"
+        "#include <string>\n"
+        "#include <type_traits>\n\n"
+        "// Flash is memory-mapped and byte-addressable everywhere except ESP8266,\n"
+        "// where PROGMEM strings can only be read through pgm_read_* / memcpy_P\n"
+        "#if defined(ESP8266) || defined(ARDUINO_ARCH_ESP8266)\n"
+        "#define I18N_FLASH_DIRECT 0\n"
+        "#else\n"
+        "#define I18N_FLASH_DIRECT 1\n"
+        "#endif\n\n"
+        "// Strings are stored compressed and must be decoded before use\n"
+        f"#define I18N_COMPRESSED {int(compression != 'none')}\n\n"
+        "// Translations can be referenced in flash without copying\n"
+        "#define I18N_ZERO_COPY (I18N_FLASH_DIRECT && !I18N_COMPRESSED)\n\n"
+        "// Strings are read from a data partition, locales are mapped once selected\n"
+        f"#define I18N_EXTERNAL_STORAGE {int(partition is not None)}\n\n"
+        "// Lookups are counted and timed (statistics: true)\n"
+        f"#define I18N_STATISTICS {int(statistics)}\n\n"
         "namespace esphome {\n"
         "namespace i18n {\n\n"
-        "// Main translation function - returns translated string for given key\n"
+        "// Compile-time translation key IDs (index into the locale tables)\n"
+        "enum class Key : uint16_t {\n"
+        f"{enum_elems}"
+        "};\n\n"
+        "// Locales compiled into the firmware (index into the locale tables)\n"
+        "enum class Locale : uint8_t {\n"
+        f"{locale_elems}"
+        "};\n\n"
+        "// Main translation function - returns translated string for given key.\n"
+        "// Points into flash, or the mapped partition; on ESP8266 or when compressed it is\n"
+        "// the buffer of the calling task shared with tr_ptr(), overwritten by its next call.\n"
         "const char* tr(const char* key);\n\n"
-        "// Set current locale (e.g., \"en\", \"ru\", \"de\")\n"
+        "// Translation by compile-time key ID - no key search\n"
+        "const char* tr(Key key);\n\n"
+        "// Reentrant translation into the caller's buffer, safe to call from any task or core.\n"
+        "// Returns the full length like snprintf; the copy is truncated if it is >= n.\n"
+        "size_t tr(const char* key, char* buf, size_t n);\n"
+        "size_t tr(Key key, char* buf, size_t n);\n\n"
+        "// Zero-copy translation - pointer to the string in flash, length in *len if given.\n"
+        "// On ESP8266 or when compressed the string is copied into a buffer of the calling\n"
+        "// task, overwritten by its next call.\n"
+        "const char* tr_ptr(const char* key, size_t* len = nullptr);\n"
+        "const char* tr_ptr(Key key, size_t* len = nullptr);\n\n"
+        "// Set current locale (e.g., \"en\", \"ru\", \"de\"), through the component when there is one\n"
         "void set_locale(const char* loc);\n\n"
         "// Get current locale\n"
         "const char* get_locale();\n\n"
         "// Internal functions (do not call directly)\n"
         "void i18n_set_locale_internal(const char* loc);\n"
-        "void i18n_get_buf_internal(const char* loc, const char* key, char* buf, size_t n);\n\n"
+        "void i18n_set_locale_handler_internal(void (*handler)(const char* loc));\n"
+        "bool i18n_set_locale_index_internal(Locale loc);\n"
+        "Locale i18n_get_locale_index_internal();\n"
+        "int i18n_locale_index_internal(const char* loc);\n"
+        "size_t i18n_get_buf_internal(Locale loc, const char* key, char* buf, size_t n);\n"
+        "size_t i18n_get_buf_internal(Locale loc, Key key, char* buf, size_t n);\n"
+        "int i18n_key_index_internal(const char* key);\n"
+        "const char* i18n_get_view_internal(Locale loc, const char* key, size_t* len);\n"
+        "const char* i18n_get_view_internal(Locale loc, Key key, size_t* len);\n"
+        "#if I18N_ZERO_COPY\n"
+        "size_t i18n_get_views_internal(Locale loc, const Key* keys, const char** out, size_t n);\n"
+        "#endif\n\n"
+        "// Argument of format(), converted from the caller's type without allocating\n"
+        "struct FormatArg {\n"
+        "  enum Type : uint8_t { INT, UINT, FLOAT, STR };\n"
+        "  Type type;\n"
+        "  union {\n"
+        "    int64_t i;\n"
+        "    uint64_t u;\n"
+        "    double f;\n"
+        "    const char* s;\n"
+        "  };\n"
+        "  template<typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>\n"
+        "  FormatArg(T v) : type(INT), i(v) {}\n"
+        "  template<typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value, int>::type = 0>\n"
+        "  FormatArg(T v) : type(UINT), u(v) {}\n"
+        "  template<typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>\n"
+        "  FormatArg(T v) : type(FLOAT), f(v) {}\n"
+        "  FormatArg(const char* v) : type(STR), s(v) {}\n"
+        "  FormatArg(const std::string& v) : type(STR), s(v.c_str()) {}\n"
+        "};\n\n"
+        "size_t i18n_format_internal(Locale loc, Key key, char* buf, size_t n, const FormatArg* args, size_t count);\n\n"
+        "// Fill the {placeholders} of a translation and write it to buf. Arguments go in the\n"
+        "// order the placeholders first appear in the default locale (listed at the Key entry).\n"
+        "// Returns the full length like snprintf. String arguments must not come from tr_ptr().\n"
+        "template<typename... Args> size_t format(char* buf, size_t n, Locale loc, Key key, const Args&... args) {\n"
+        "  const FormatArg list[] = {FormatArg(args)..., FormatArg(0)};\n"
+        "  return i18n_format_internal(loc, key, buf, n, list, sizeof...(Args));\n"
+        "}\n"
+        "template<typename... Args> size_t format(char* buf, size_t n, Key key, const Args&... args) {\n"
+        "  return format(buf, n, i18n_get_locale_index_internal(), key, args...);\n"
+        "}\n\n"
+        "Key i18n_plural_key_internal(Locale loc, Key key, uint32_t n);\n\n"
+        "// Plural form of a key for the count n (CLDR rules of the current locale),\n"
+        "// key itself if it has no plural forms\n"
+        "Key plural(Key key, int32_t n);\n\n"
         "// Default locale constant\n"
         "extern const char TRANSLATIONS_DEFAULT_LOCALE[];\n\n"
+        "// Locale codes, indexed by Locale\n"
+        "extern const char* const I18N_LOCALE_CODES[];\n\n"
+        "// Fingerprint of the keys and texts of each locale, indexed by Locale\n"
+        "extern const uint32_t I18N_LOCALE_HASHES[];\n\n"
+        "// Bytes of flash taken by the translations, as computed by the build\n"
+        "struct I18nFootprint {\n"
+        "  uint32_t strings;    // String pool after deduplication and compression\n"
+        "  uint32_t tables;     // Offset and length tables, with alignment\n"
+        "  uint32_t keys;       // Key names for string lookups\n"
+        "  uint32_t saved;      // Saved by deduplication and compression\n"
+        "  uint32_t partition;  // Locale blobs on the data partition, not in the firmware\n"
+        "};\n"
+        "extern const I18nFootprint I18N_FOOTPRINT;\n\n"
+        "// Total number of locales and index of the default one\n"
+        f"static constexpr size_t I18N_LOCALE_COUNT = {len(locales)};\n"
+        f"static constexpr uint8_t I18N_DEFAULT_LOCALE_INDEX = {locales.index(default_locale)};\n\n"
         "// Total number of translation keys\n"
         f"static constexpr size_t I18N_KEY_COUNT = {len(all_keys)};\n\n"
-        "} // namespace i18n\n"
+        "// Length in bytes of the longest translated string\n"
+        f"static constexpr size_t I18N_MAX_LEN = {max_len};\n\n"
+        "// Fingerprint of the key IDs and locale indices, data stored by key ID is\n"
+        "// only valid for firmware with the same layout\n"
+        f"static constexpr uint32_t I18N_LAYOUT_HASH = 0x{_layout_hash(all_keys, locales):08X}u;\n\n"
+        + (
+            "// Label of the data partition holding the locale blobs\n"
+            f'static constexpr const char I18N_PARTITION_LABEL[] = "{_cpp_escape_literal(partition)}";\n'
+            "bool i18n_map_locale_internal(Locale loc);\n\n"
+            if partition is not None
+            else ""
+        )
+        + (
+            "// Lookup statistics. Plain counters: a lookup racing another task may\n"
+            "// occasionally lose an increment, which is fine for profiling\n"
+            "struct I18nStats {\n"
+            "  uint32_t lookups;                // Translations fetched by key ID\n"
+            "  uint32_t misses;                 // String keys not found, translated as themselves\n"
+            "  uint32_t micros;                 // Time spent in lookups\n"
+            "  uint16_t hits[I18N_KEY_COUNT];  // Lookups per key ID, saturating at 65535\n"
+            "};\n"
+            "extern I18nStats i18n_stats;\n\n"
+            "void i18n_count_lookup_internal(Key key, uint32_t micros);\n"
+            "void i18n_count_miss_internal();\n\n"
+            if statistics
+            else ""
+        )
+        + "// Key name of a key ID, empty for IDs out of range\n"
+        "const char* i18n_key_name_internal(Key key);\n\n"
+        + "} // namespace i18n\n"
         "} // namespace esphome\n"
     )
 
 # ------------------ Generate translations.cpp ------------------
 
-def _gen_translations_cpp(locales_map: dict[str, dict[str, str]], default_locale: str, all_keys: list[str]) -> str:
+def _locale_pool_name(upper: str, compressed: bool) -> str:
+    """Symbol of the string pool of one locale in its own unit."""
+    return f"I18N_PACKED_{upper}" if compressed else f"I18N_STRINGS_{upper}"
+
+def _gen_locale_unit(loc: str, upper: str, texts: list[str], layout: dict) -> str:
+    """
+    Generate translations_<locale>.cpp: the string pool and tables of one locale.
+
+    texts are the locale's strings in key order, layout what _gen_translations_cpp()
+    stored for the split build: table types and the code lengths of the shared
+    Huffman code when compressed.
+    """
+    compressed = layout["compressed"]
+    code_lengths = {b: n for b, n in enumerate(layout["code_lengths"]) if n} if compressed else None
+    hosts, refs = _build_string_pool(texts, tail_merge=not compressed)
+    packed, host_offsets = _lay_out_pool(hosts, code_lengths)
+    pool_type = "uint8_t" if compressed else "char"
+    pool_name = _locale_pool_name(upper, compressed)
+    off_type, len_type = layout["off_type"], layout["len_type"]
+    off_elems = ", ".join(str(host_offsets[refs[t][0]] + refs[t][1]) for t in texts)
+    len_elems = ", ".join(str(len(t.encode("utf-8"))) for t in texts)
+    pool_lines = _pool_source(hosts, packed if compressed else None)
+
+    parts = []
+    parts.append('#include "generated/translations.h"')
+    parts.append("#ifdef ARDUINO")
+    parts.append("#include <pgmspace.h>")
+    parts.append("#else")
+    parts.append("#define PROGMEM")
+    parts.append("#endif\n")
+    parts.append("namespace esphome {")
+    parts.append("namespace i18n {\n")
+    parts.append(f"// Locale: {loc}, looked up through translations.cpp")
+    parts.append(f"extern const {pool_type} {pool_name}[];")
+    parts.append(f"extern const {off_type} OFF_{upper}[];")
+    parts.append(f"extern const {len_type} LEN_{upper}[];\n")
+    if pool_type == "char":
+        parts.append(f"const char {pool_name}[] PROGMEM =")
+        parts.append(pool_lines + ";")
+    else:
+        parts.append(f"const uint8_t {pool_name}[] PROGMEM = {{")
+        parts.append(pool_lines)
+        parts.append("};")
+    parts.append(f"const {off_type} OFF_{upper}[] PROGMEM = {{\n  {off_elems}\n}};")
+    parts.append(f"const {len_type} LEN_{upper}[] PROGMEM = {{\n  {len_elems}\n}};\n")
+    parts.append("} // namespace i18n")
+    parts.append("} // namespace esphome\n")
+    return "\n".join(parts)
+
+def _gen_translations_cpp(
+    locales_map: dict[str, dict[str, str]],
+    default_locale: str,
+    all_keys: list[str],
+    key_lookup: str = "binary",
+    compression: str = "none",
+    partition: str | None = None,
+    plurals: dict[str, list[str]] | None = None,
+    statistics: bool = False,
+    layout: dict | None = None,
+    footprint: dict | None = None,
+) -> str:
     """
     Generate C++ implementation file with translation tables.
     
     Creates PROGMEM string tables for each locale to save RAM on embedded devices.
+    With a partition label the strings are left out and read from that data
+    partition instead. Keys must be sorted, which the binary search lookup relies on.
+
+    If layout is given, every locale gets its own string pool and tables in
+    translations_<locale>.cpp, generated one locale at a time by
+    _gen_locale_unit() from what is stored in layout; the returned source then
+    only refers to them. If footprint is given, it receives the flash sizes
+    described in _footprint_totals().
     """
+    if not all_keys:
+        raise cv.Invalid("No translation keys found in sources")
+
     # Validate that all keys have translations in all locales
     missing_report = []
     for loc, kv in locales_map.items():
@@ -149,44 +1818,192 @@ def _gen_translations_cpp(locales_map: dict[str, dict[str, str]], default_locale
         if missing:
             missing_report.append(f"{loc}: {', '.join(missing)}")
     if missing_report:
-        raise cv.Invalid("Missing translations for keys:\n" + "\n".join(missing_report))
+        raise cv.Invalid(
+            "Missing translations for keys (translate them or set a `fallback:` locale):\n" + "\n".join(missing_report)
+        )
 
-    # Generate string tables for each locale
-    block_strings = []
-    for loc in sorted(locales_map.keys()):
-        upper = loc.upper()
-        strings = []
-        
-        # Create PROGMEM string constants for each translation
-        for k in all_keys:
-            lit = _cpp_escape_literal(locales_map[loc][k])
-            sym = f"STR_{upper}_{_sym_from_key(k)}"
-            strings.append(f'static const char {sym}[] PROGMEM = "{lit}";')
-        
-        # Create lookup table with pointers to strings
-        table_elems = ",\n  ".join([f'STR_{upper}_{_sym_from_key(k)}' for k in all_keys])
-        block = (
-            f"// Locale: {loc}\n"
-            + "\n".join(strings)
-            + f"\nstatic const char* const TABLE_{upper}[] PROGMEM = {{\n  {table_elems}\n}};\n"
+    locales = sorted(locales_map.keys())
+    locale_symbols = _locale_symbols(locales)
+
+    compressed = compression != "none"
+    if partition is None:
+        # Smallest type that holds every string length
+        len_type, len_read = _uint_type_for(_max_string_len(locales_map))
+        slot_bytes = sum(len(locales_map[loc][k].encode("utf-8")) + 1 for loc in locales for k in all_keys)
+
+        # Intern the strings into one pool shared by all locales, or one pool per locale when
+        # split into units; a compressed string can only be decoded from its start, so tails
+        # are not shared then
+        split = layout is not None
+        if split:
+            # Units are generated later one locale at a time, only the sizes of their pools
+            # and, for the shared Huffman code, their byte counts are gathered here
+            pool_entries = 0
+            pool_bytes = 0
+            pool_sizes = []
+            freqs: dict[int, int] = {}
+            for loc in locales:
+                hosts, _ = _build_string_pool(locales_map[loc].values(), tail_merge=not compressed)
+                pool_entries += len(hosts)
+                pool_sizes.append(sum(len(h) + 1 for h in hosts))
+                if compressed:
+                    _byte_freqs(hosts, freqs)
+            pool_bytes = sum(pool_sizes)
+            code_lengths = _huffman_code_lengths(freqs) if freqs else {}
+            if compressed:
+                huff_counts, huff_symbols, _ = _huffman_code(code_lengths)
+                # Coded size of each pool, every string padded to a byte
+                pool_sizes = [
+                    sum(
+                        (sum(code_lengths[b] for b in h) + 7) // 8
+                        for h in _build_string_pool(locales_map[loc].values(), tail_merge=False)[0]
+                    )
+                    for loc in locales
+                ]
+            strings_size = sum(pool_sizes)
+            off_type, off_read = _uint_type_for(max(pool_sizes, default=0))
+            layout.update(
+                {
+                    "compressed": compressed,
+                    "off_type": off_type,
+                    "len_type": len_type,
+                    "code_lengths": [code_lengths.get(b, 0) for b in range(256)],
+                }
+            )
+        else:
+            pool_hosts, pool_refs = _build_string_pool(
+                (v for kv in locales_map.values() for v in kv.values()), tail_merge=not compressed
+            )
+            pool_entries = len(pool_hosts)
+            pool_bytes = sum(len(h) + 1 for h in pool_hosts)
+        _LOGGER.info(
+            "i18n string pool: %d strings in %d pool entries, %d of %d bytes saved by deduplication",
+            len(locales) * len(all_keys), pool_entries, slot_bytes - pool_bytes, slot_bytes,
         )
-        block_strings.append(block)
 
-    blocks_joined = "\n".join(block_strings)
-    
+        if not split:
+            code_lengths = None
+            if compressed:
+                # Huffman-code the pool with one code, each string starting on a byte
+                freqs = {}
+                _byte_freqs(pool_hosts, freqs)
+                code_lengths = _huffman_code_lengths(freqs) if freqs else {}
+                huff_counts, huff_symbols, _ = _huffman_code(code_lengths)
+            blob, host_offsets = _lay_out_pool(pool_hosts, code_lengths)
+            strings_size = len(blob)
+            off_type, off_read = _uint_type_for(len(blob))
+        if compressed:
+            _LOGGER.info(
+                "i18n huffman compression: %d of %d pool bytes (%.0f%%)",
+                strings_size, pool_bytes, 100.0 * strings_size / pool_bytes if pool_bytes else 0.0,
+            )
+
+        pool_type = "uint8_t" if compressed else "char"
+        if split:
+            pool_names = [_locale_pool_name(upper, compressed) for upper in locale_symbols]
+        else:
+            pool_names = ["I18N_PACKED" if compressed else "I18N_STRINGS"] * len(locales)
+
+        # Generate string tables for each locale
+        block_strings = []
+        for li, (loc, upper) in enumerate(zip(locales, locale_symbols)):
+            if split:
+                block = (
+                    f"extern const {pool_type} {pool_names[li]}[];\n"
+                    + f"extern const i18n_off_t OFF_{upper}[];\n"
+                    + f"extern const i18n_len_t LEN_{upper}[];\n"
+                )
+            else:
+                # Offsets into the string blob, half the size of pointers for most catalogs
+                off_elems = ", ".join(
+                    str(host_offsets[pool_refs[locales_map[loc][k]][0]] + pool_refs[locales_map[loc][k]][1])
+                    for k in all_keys
+                )
+                # Byte lengths parallel to the table, so callers get the length without strlen
+                len_elems = ", ".join(str(len(locales_map[loc][k].encode("utf-8"))) for k in all_keys)
+                block = (
+                    f"// Locale: {loc}\n"
+                    + f"static const i18n_off_t OFF_{upper}[] PROGMEM = {{\n  {off_elems}\n}};\n"
+                    + f"static const i18n_len_t LEN_{upper}[] PROGMEM = {{\n  {len_elems}\n}};\n"
+                )
+            block_strings.append(block)
+
+        blocks_joined = "\n".join(block_strings)
+
+        # Offset and length tables of every locale, each may need padding to its alignment,
+        # plus the locale table and the Huffman code
+        off_size, len_size = _UINT_SIZES[off_type], _UINT_SIZES[len_type]
+        code_bytes = 2 * (_HUFF_MAX_BITS + 1) + max(len(huff_symbols), 1) if compressed else 0
+        fp = {
+            "strings": strings_size,
+            "tables": len(locales) * (len(all_keys) * (off_size + len_size) + _PTR_SIZE * 3) + code_bytes,
+            "padding": len(locales) * (off_size - 1 + len_size - 1),
+            "saved": slot_bytes - strings_size,
+            "partition": 0,
+            "locales": {
+                loc: {
+                    "text": sum(len(locales_map[loc][k].encode("utf-8")) + 1 for k in all_keys),
+                    "tables": len(all_keys) * (off_size + len_size),
+                }
+                for loc in locales
+            },
+        }
+    else:
+        # Only the keys stay in the firmware, strings and tables are in the blobs
+        keys_hash = _keys_hash(locales_map, all_keys)
+        blob_sizes = {
+            loc: len(_build_locale_blob([locales_map[loc][k] for k in all_keys], keys_hash)) for loc in locales
+        }
+        fp = {
+            "strings": 0,
+            # Partition label
+            "tables": len(partition.encode("utf-8")) + 1,
+            "padding": 0,
+            "saved": 0,
+            "partition": sum(blob_sizes.values()),
+            "locales": {
+                loc: {
+                    "text": sum(len(locales_map[loc][k].encode("utf-8")) + 1 for k in all_keys),
+                    "tables": blob_sizes[loc],
+                }
+                for loc in locales
+            },
+        }
+    # Key names and the pointer table over them
+    fp["keys"] = sum(len(k.encode("utf-8")) + 1 + _PTR_SIZE for k in all_keys)
+    # Default locale, locale codes with their pointer table, and locale hashes
+    _count_table(fp, len(default_locale.encode("utf-8")) + 1)
+    _count_table(fp, sum(len(loc.encode("utf-8")) + 1 + _PTR_SIZE for loc in locales))
+    _count_table(fp, 4 * len(locales), 4)
+
+    # Key lookup, format and plural tables, generated here to count them in the footprint
+    key_lookup_lines = _gen_key_lookup(all_keys, key_lookup, fp)
+    templates = _format_templates(locales_map, default_locale, all_keys, plurals)
+    format_lines = _gen_format_tables(locales_map, all_keys, templates, locales, locale_symbols, fp)
+    plural_lines = _gen_plural_rules(all_keys, plurals or {}, locales, fp)
+    if footprint is not None:
+        footprint.update(fp)
+
     # Create master key list
     keys_literals = ",\n  ".join([f'"{_cpp_escape_literal(k)}"' for k in all_keys])
 
-    # Generate locale selection switch cases
-    case_lines = []
-    for loc in sorted(locales_map.keys()):
-        case_lines.append(f'  if (strcmp(loc, "{loc}") == 0) return TABLE_{loc.upper()};')
-    select_table_cases = "\n".join(case_lines)
+    # Locale codes and per-locale tables, both indexed by Locale
+    locale_codes = ", ".join(f'"{_cpp_escape_literal(loc)}"' for loc in locales)
+    if partition is None:
+        locale_elems = ",\n  ".join(
+            f"{{OFF_{upper}, LEN_{upper}, {pool}}}" for upper, pool in zip(locale_symbols, pool_names)
+        )
 
     # Build complete C++ source
     parts = []
     parts.append('#include "generated/translations.h"')
+    parts.append("#include <stdio.h>")
     parts.append("#include <string.h>")
+    parts.append("#include <atomic>")
+    if partition is not None:
+        parts.append("#include <esp_partition.h>")
+    if statistics:
+        parts.append('#include "esphome/core/hal.h"')
     
     # PROGMEM compatibility layer for different platforms
     parts.append("#ifdef ARDUINO")
@@ -194,7 +2011,10 @@ def _gen_translations_cpp(locales_map: dict[str, dict[str, str]], default_locale
     parts.append("#else")
     parts.append("#define PROGMEM")
     parts.append("#define pgm_read_ptr(addr) (*(addr))")
-    parts.append("#define strncpy_P strncpy")
+    parts.append("#define pgm_read_byte(addr) (*(addr))")
+    parts.append("#define pgm_read_word(addr) (*(addr))")
+    parts.append("#define pgm_read_dword(addr) (*(addr))")
+    parts.append("#define memcpy_P memcpy")
     parts.append("#endif\n")
 
     parts.append("namespace esphome {")
@@ -202,7 +2022,15 @@ def _gen_translations_cpp(locales_map: dict[str, dict[str, str]], default_locale
 
     # Default locale constant
     parts.append(f'const char TRANSLATIONS_DEFAULT_LOCALE[] = "{default_locale}";')
-    parts.append("static const char* current_loc = TRANSLATIONS_DEFAULT_LOCALE;\n")
+    parts.append(f"const char* const I18N_LOCALE_CODES[] = {{{locale_codes}}};")
+    locale_hashes = ", ".join(f"0x{_locale_hash(all_keys, locales_map[loc]):08X}u" for loc in locales)
+    parts.append(f"const uint32_t I18N_LOCALE_HASHES[] = {{{locale_hashes}}};")
+    parts.append(
+        f"const I18nFootprint I18N_FOOTPRINT = {{{fp['strings']}, {fp['tables'] + fp['padding']}, {fp['keys']}, "
+        f"{fp['saved']}, {fp['partition']}}};"
+    )
+    parts.append("// Active locale, the only mutable lookup state: written on locale switches, read from any task")
+    parts.append("static std::atomic<uint8_t> current_loc{I18N_DEFAULT_LOCALE_INDEX};\n")
 
     # Master key list
     parts.append("// Master list of all translation keys")
@@ -210,82 +2038,334 @@ def _gen_translations_cpp(locales_map: dict[str, dict[str, str]], default_locale
     parts.append(f"  {keys_literals}")
     parts.append("};")
     parts.append("static constexpr size_t I18N_KEYS_COUNT = sizeof(I18N_KEYS)/sizeof(I18N_KEYS[0]);\n")
+    parts.append("const char* i18n_key_name_internal(Key key) {")
+    parts.append("  return (size_t)key < I18N_KEYS_COUNT ? I18N_KEYS[(size_t)key] : \"\";")
+    parts.append("}\n")
 
-    # Translation tables
-    parts.append("// Translation tables for each locale")
-    parts.append(blocks_joined)
+    if statistics:
+        parts.append("// Lookup statistics, zeroed at boot")
+        parts.append("I18nStats i18n_stats = {};\n")
+        parts.append("void i18n_count_lookup_internal(Key key, uint32_t micros) {")
+        parts.append("  size_t idx = (size_t)key;")
+        parts.append("  i18n_stats.lookups++;")
+        parts.append("  i18n_stats.micros += micros;")
+        parts.append("  if (idx < I18N_KEYS_COUNT && i18n_stats.hits[idx] != UINT16_MAX) i18n_stats.hits[idx]++;")
+        parts.append("}\n")
+        parts.append("void i18n_count_miss_internal() {")
+        parts.append("  i18n_stats.misses++;")
+        parts.append("}\n")
+        parts.append("// Counts a lookup and the time it took, when the scope ends.")
+        parts.append("// Length-only queries (no buffer) are not counted as lookups.")
+        parts.append("struct I18nLookupTimer {")
+        parts.append("  Key key;")
+        parts.append("  bool counted;")
+        parts.append("  uint32_t start;")
+        parts.append("  I18nLookupTimer(Key key, bool counted) : key(key), counted(counted), start(micros()) {}")
+        parts.append("  ~I18nLookupTimer() {")
+        parts.append("    if (counted) i18n_count_lookup_internal(key, micros() - start);")
+        parts.append("  }")
+        parts.append("};\n")
 
-    # Locale setter
-    parts.append("// Set current locale")
+    if partition is None:
+        # Per-locale data: offset table plus parallel length table
+        parts.append(f"typedef {off_type} i18n_off_t;")
+        parts.append(f"typedef {len_type} i18n_len_t;")
+        parts.append("struct I18nLocaleData {")
+        parts.append("  const i18n_off_t* offsets;")
+        parts.append("  const i18n_len_t* lengths;")
+        parts.append(f"  const {pool_type}* strings;  // String pool the offsets point into")
+        parts.append("};\n")
+
+        # Shared string pool
+        if compressed:
+            parts.append("// Canonical Huffman code: number of codes per bit length, then symbols in code order")
+            parts.append(f"static const uint16_t I18N_HUFF_COUNTS[{_HUFF_MAX_BITS + 1}] PROGMEM = {{")
+            parts.append("  " + ", ".join(str(c) for c in huff_counts))
+            parts.append("};")
+            parts.append("static const uint8_t I18N_HUFF_SYMBOLS[] PROGMEM = {")
+            parts.append("  " + (", ".join(str(sym) for sym in huff_symbols) or "0"))
+            parts.append("};\n")
+        # Split units hold the pools of their locales
+        if not split:
+            if compressed:
+                parts.append("// Interned strings shared by all locales and keys, Huffman-coded, each starting on a byte")
+                parts.append("static const uint8_t I18N_PACKED[] PROGMEM = {")
+                parts.append(_pool_source(pool_hosts, blob))
+                parts.append("};\n")
+            else:
+                parts.append("// Interned strings shared by all locales and keys, in one contiguous blob")
+                parts.append("static const char I18N_STRINGS[] PROGMEM =")
+                parts.append(_pool_source(pool_hosts, None) + ";\n")
+
+        # Translation tables
+        if split:
+            parts.append("// String pools and translation tables of each locale, in translations_<locale>.cpp")
+        else:
+            parts.append("// Translation tables for each locale")
+        parts.append(blocks_joined)
+
+        # Locale table list
+        parts.append("// Translation tables indexed by Locale")
+        parts.append("static const I18nLocaleData LOCALES[] = {")
+        parts.append(f"  {locale_elems}")
+        parts.append("};\n")
+
+    else:
+        parts.extend(_gen_partition_storage(locales_map, all_keys, partition, statistics))
+
+    # Locale resolver - only used when switching by name, never per lookup
+    parts.append("// Resolve locale code to its index, -1 if unknown")
+    parts.append("int i18n_locale_index_internal(const char* loc) {")
+    parts.append("  if (!loc) return -1;")
+    parts.append("  for (size_t i = 0; i < I18N_LOCALE_COUNT; ++i) {")
+    parts.append("    if (strcmp(I18N_LOCALE_CODES[i], loc) == 0) return (int)i;")
+    parts.append("  }")
+    parts.append("  return -1;")
+    parts.append("}\n")
+
+    # Locale setters
+    parts.append("// Set current locale by code (unknown codes are ignored)")
     parts.append("void i18n_set_locale_internal(const char* loc) {")
-    parts.append("  if (loc) current_loc = loc;")
+    parts.append("  int idx = i18n_locale_index_internal(loc);")
+    parts.append("  if (idx >= 0) i18n_set_locale_index_internal((Locale)idx);")
+    parts.append("}\n")
+    parts.append("// Set current locale by index, false if it is unknown or cannot be loaded")
+    parts.append("bool i18n_set_locale_index_internal(Locale loc) {")
+    parts.append("  if ((size_t)loc >= I18N_LOCALE_COUNT) return false;")
+    if partition is not None:
+        parts.append("  if (!map_locale((size_t)loc)) return false;")
+    parts.append("  current_loc.store((uint8_t)loc, std::memory_order_release);")
+    parts.append("  return true;")
+    parts.append("}\n")
+    parts.append("// Get current locale index")
+    parts.append("Locale i18n_get_locale_index_internal() {")
+    parts.append("  return (Locale)current_loc.load(std::memory_order_acquire);")
     parts.append("}\n")
 
     # Table selector
-    parts.append("// Select translation table for given locale")
-    parts.append("static const char* const* select_table(const char* loc) {")
-    parts.append(select_table_cases)
-    parts.append(f"  // Fallback to default locale")
-    parts.append(f"  return TABLE_{default_locale.upper()};")
-    parts.append("}\n")
+    if partition is None:
+        parts.append("// Select translation table for given locale")
+        parts.append("static const I18nLocaleData* select_table(Locale loc) {")
+        parts.append("  size_t idx = (size_t)loc;")
+        parts.append("  // Fallback to default locale")
+        parts.append("  return &LOCALES[idx < I18N_LOCALE_COUNT ? idx : I18N_DEFAULT_LOCALE_INDEX];")
+        parts.append("}\n")
 
     # Key index finder
-    parts.append("// Find index of translation key in master list")
-    parts.append("static int key_index_of(const char* key) {")
-    parts.append("  for (size_t i = 0; i < I18N_KEYS_COUNT; ++i) {")
-    parts.append("    if (strcmp(I18N_KEYS[i], key) == 0) return (int)i;")
-    parts.append("  }")
-    parts.append("  return -1;  // Key not found")
-    parts.append("}\n")
+    parts.extend(key_lookup_lines)
 
-    # PROGMEM pointer reader
-    parts.append("// Read pointer from PROGMEM table")
-    parts.append("static const char* get_ptr_from_progmem(const char* const* table, size_t idx) {")
-    parts.append("  return (const char*)pgm_read_ptr(&(table[idx]));")
-    parts.append("}\n")
+    if partition is None:
+        # PROGMEM pointer reader
+        parts.append("// Resolve string pointer from PROGMEM offset table")
+        parts.append(f"static const {pool_type}* get_ptr_from_progmem(const I18nLocaleData* table, size_t idx) {{")
+        parts.append(f"  return table->strings + {off_read}(&(table->offsets[idx]));")
+        parts.append("}\n")
 
-    # Translation getter with buffer
-    parts.append("// Get translation into buffer (internal use)")
-    parts.append("void i18n_get_buf_internal(const char* loc, const char* key, char* buf, size_t n) {")
-    parts.append("  if (!buf || n == 0) return;")
-    parts.append("  if (!key) { buf[0] = '\\0'; return; }")
-    parts.append("  ")
-    parts.append("  // Find key index")
+        if compressed:
+            # Canonical Huffman decoder, one bit at a time - hot strings are cached by the component
+            parts.append("// Decode the first n bytes of a Huffman-coded string")
+            parts.append("static void huff_decode(const uint8_t* src, char* dst, size_t n) {")
+            parts.append("  uint8_t cur = 0;")
+            parts.append("  uint8_t mask = 0;")
+            parts.append("  for (size_t i = 0; i < n; ++i) {")
+            parts.append("    int code = 0, first = 0, index = 0;")
+            parts.append(f"    for (int bits = 1; bits <= {_HUFF_MAX_BITS}; ++bits) {{")
+            parts.append("      if (mask == 0) {")
+            parts.append("        cur = pgm_read_byte(src++);")
+            parts.append("        mask = 0x80;")
+            parts.append("      }")
+            parts.append("      code |= (cur & mask) ? 1 : 0;")
+            parts.append("      mask >>= 1;")
+            parts.append("      int count = pgm_read_word(&I18N_HUFF_COUNTS[bits]);")
+            parts.append("      if (code - first < count) {")
+            parts.append("        dst[i] = (char)pgm_read_byte(&I18N_HUFF_SYMBOLS[index + code - first]);")
+            parts.append("        break;")
+            parts.append("      }")
+            parts.append("      index += count;")
+            parts.append("      first = (first + count) << 1;")
+            parts.append("      code <<= 1;")
+            parts.append("    }")
+            parts.append("  }")
+            parts.append("}\n")
+
+        # PROGMEM length reader
+        parts.append("// Read string length from PROGMEM length table")
+        parts.append("static size_t get_len_from_progmem(const i18n_len_t* lengths, size_t idx) {")
+        parts.append(f"  return (size_t){len_read}(&(lengths[idx]));")
+        parts.append("}\n")
+
+        # Translation getter by key ID
+        parts.append("// Copy translation into buffer (internal use).")
+        parts.append("// Returns the full length like snprintf; the copy is truncated if it is >= n.")
+        parts.append("size_t i18n_get_buf_internal(Locale loc, Key key, char* buf, size_t n) {")
+        parts.append("  size_t idx = (size_t)key;")
+        if statistics:
+            parts.append("  I18nLookupTimer timer(key, buf != nullptr);")
+        parts.append("  if (idx >= I18N_KEYS_COUNT) {")
+        parts.append("    if (buf && n) buf[0] = '\\0';")
+        parts.append("    return 0;")
+        parts.append("  }")
+        parts.append("  ")
+        parts.append("  // Select appropriate translation table")
+        parts.append("  auto table = select_table(loc);")
+        parts.append("  size_t len = get_len_from_progmem(table->lengths, idx);")
+        parts.append("  if (!buf || n == 0) return len;")
+        parts.append("  ")
+        parts.append("  // Copy only the real bytes from PROGMEM")
+        parts.append("  size_t copy = len < n ? len : n - 1;")
+        if compressed:
+            parts.append("  huff_decode(get_ptr_from_progmem(table, idx), buf, copy);")
+        else:
+            parts.append("  memcpy_P(buf, get_ptr_from_progmem(table, idx), copy);")
+        parts.append("  buf[copy] = '\\0';")
+        parts.append("  return len;")
+        parts.append("}\n")
+
+    # Translation getter by string key
+    parts.append("// Copy translation for string key into buffer (internal use)")
+    parts.append("size_t i18n_get_buf_internal(Locale loc, const char* key, char* buf, size_t n) {")
+    parts.append("  if (!key) key = \"\";")
     parts.append("  int idx = key_index_of(key);")
-    parts.append("  if (idx < 0) {")
-    parts.append("    // Key not found - return key itself as fallback")
-    parts.append("    strncpy(buf, key, n - 1);")
-    parts.append("    buf[n - 1] = '\\0';")
-    parts.append("    return;")
-    parts.append("  }")
-    parts.append("  ")
-    parts.append("  // Select appropriate translation table")
-    parts.append("  auto table = select_table(loc && loc[0] ? loc : TRANSLATIONS_DEFAULT_LOCALE);")
+    parts.append("  if (idx >= 0) return i18n_get_buf_internal(loc, (Key)idx, buf, n);")
     parts.append("  ")
-    parts.append("  // Read string from PROGMEM")
-    parts.append("  const char* p = get_ptr_from_progmem(table, (size_t)idx);")
-    parts.append("  strncpy_P(buf, p, n - 1);")
-    parts.append("  buf[n - 1] = '\\0';")
+    parts.append("  // Key not found - return key itself as fallback")
+    if statistics:
+        parts.append("  i18n_count_miss_internal();")
+    parts.append("  size_t len = strlen(key);")
+    parts.append("  if (!buf || n == 0) return len;")
+    parts.append("  size_t copy = len < n ? len : n - 1;")
+    parts.append("  memcpy(buf, key, copy);")
+    parts.append("  buf[copy] = '\\0';")
+    parts.append("  return len;")
     parts.append("}\n")
 
+    # Key resolver
+    parts.append("// Resolve string key to its key ID, -1 if unknown (internal use)")
+    parts.append("int i18n_key_index_internal(const char* key) {")
+    parts.append("  return key ? key_index_of(key) : -1;")
+    parts.append("}\n")
+
+    # Zero-copy getters
+    string_key_view = [
+        "const char* i18n_get_view_internal(Locale loc, const char* key, size_t* len) {",
+        "  if (!key) key = \"\";",
+        "  int idx = key_index_of(key);",
+        "  if (idx < 0) {",
+        "    // Key not found - return key itself as fallback",
+        *(["    i18n_count_miss_internal();"] if statistics else []),
+        "    if (len) *len = strlen(key);",
+        "    return key;",
+        "  }",
+        "  return i18n_get_view_internal(loc, (Key)idx, len);",
+        "}",
+    ]
+    if partition is not None:
+        # The key ID getter comes with the partition loader
+        parts.extend(string_key_view)
+        parts.append("")
+    else:
+        parts.append("#if I18N_ZERO_COPY")
+        parts.append("// Get pointer to translation in flash (internal use)")
+        parts.append("const char* i18n_get_view_internal(Locale loc, Key key, size_t* len) {")
+        parts.append("  size_t idx = (size_t)key;")
+        if statistics:
+            parts.append("  I18nLookupTimer timer(key, true);")
+        parts.append("  if (idx >= I18N_KEYS_COUNT) {")
+        parts.append("    if (len) *len = 0;")
+        parts.append("    return \"\";")
+        parts.append("  }")
+        parts.append("  auto table = select_table(loc);")
+        parts.append("  if (len) *len = get_len_from_progmem(table->lengths, idx);")
+        parts.append("  return get_ptr_from_progmem(table, idx);")
+        parts.append("}\n")
+        parts.extend(string_key_view)
+        parts.append("")
+        parts.append("// Pointers for many keys, the locale table is resolved once (internal use)")
+        parts.append("size_t i18n_get_views_internal(Locale loc, const Key* keys, const char** out, size_t n) {")
+        parts.append("  auto table = select_table(loc);")
+        parts.append("  for (size_t i = 0; i < n; ++i) {")
+        parts.append("    size_t idx = (size_t)keys[i];")
+        if statistics:
+            parts.append("    I18nLookupTimer timer(keys[i], true);")
+        parts.append("    out[i] = idx < I18N_KEYS_COUNT ? get_ptr_from_progmem(table, idx) : \"\";")
+        parts.append("  }")
+        parts.append("  return n;")
+        parts.append("}")
+        parts.append("#else")
+        parts.append("// PROGMEM is not byte-addressable or strings are compressed - copy into a buffer per task")
+        parts.append("static thread_local char view_buf[I18N_MAX_LEN + 1];")
+        parts.append("")
+        parts.append("const char* i18n_get_view_internal(Locale loc, Key key, size_t* len) {")
+        parts.append("  size_t full = i18n_get_buf_internal(loc, key, view_buf, sizeof(view_buf));")
+        parts.append("  if (len) *len = full < sizeof(view_buf) ? full : sizeof(view_buf) - 1;")
+        parts.append("  return view_buf;")
+        parts.append("}\n")
+        parts.append("const char* i18n_get_view_internal(Locale loc, const char* key, size_t* len) {")
+        parts.append("  size_t full = i18n_get_buf_internal(loc, key, view_buf, sizeof(view_buf));")
+        parts.append("  if (len) *len = full < sizeof(view_buf) ? full : sizeof(view_buf) - 1;")
+        parts.append("  return view_buf;")
+        parts.append("}")
+        parts.append("#endif  // I18N_ZERO_COPY\n")
+
+    # Format templates
+    parts.extend(format_lines)
+
+    # Plural selectors
+    parts.extend(plural_lines)
+
     # Public translation function
+    # A view of the current locale: flash or its partition mapping, otherwise the one view buffer per task
     parts.append("// Main translation function - returns translated string")
     parts.append("const char* tr(const char* key) {")
-    parts.append("  static thread_local char buf[256];") 
-    parts.append("  i18n_get_buf_internal(current_loc, key, buf, sizeof(buf));")
-    parts.append("  return buf;")
+    parts.append("  return i18n_get_view_internal((Locale)current_loc.load(std::memory_order_acquire), key, nullptr);")
+    parts.append("}\n")
+    parts.append("const char* tr(Key key) {")
+    parts.append("  return i18n_get_view_internal((Locale)current_loc.load(std::memory_order_acquire), key, nullptr);")
+    parts.append("}\n")
+
+    # Reentrant translation into a caller buffer
+    parts.append("// Reentrant translation - copies into the caller's buffer, safe from any task")
+    parts.append("size_t tr(const char* key, char* buf, size_t n) {")
+    parts.append("  return i18n_get_buf_internal((Locale)current_loc.load(std::memory_order_acquire), key, buf, n);")
+    parts.append("}\n")
+    parts.append("size_t tr(Key key, char* buf, size_t n) {")
+    parts.append("  return i18n_get_buf_internal((Locale)current_loc.load(std::memory_order_acquire), key, buf, n);")
+    parts.append("}\n")
+
+    # Public zero-copy translation functions
+    parts.append("// Zero-copy translation - returns pointer to translated string")
+    parts.append("const char* tr_ptr(const char* key, size_t* len) {")
+    parts.append("  return i18n_get_view_internal((Locale)current_loc.load(std::memory_order_acquire), key, len);")
+    parts.append("}\n")
+    parts.append("const char* tr_ptr(Key key, size_t* len) {")
+    parts.append("  return i18n_get_view_internal((Locale)current_loc.load(std::memory_order_acquire), key, len);")
+    parts.append("}\n")
+
+    # Public plural form selector
+    parts.append("// Plural form of a key for the count n in the current locale")
+    parts.append("Key plural(Key key, int32_t n) {")
+    parts.append("  return i18n_plural_key_internal((Locale)current_loc.load(std::memory_order_acquire), key, n < 0 ? 0u - (uint32_t)n : (uint32_t)n);")
     parts.append("}\n")
 
     # Public locale setter
+    parts.append("// Locale switch handler installed by the component, so set_locale() refreshes bindings too")
+    parts.append("static void (*locale_handler)(const char* loc) = nullptr;\n")
+    parts.append("void i18n_set_locale_handler_internal(void (*handler)(const char* loc)) {")
+    parts.append("  locale_handler = handler;")
+    parts.append("}\n")
     parts.append("// Set current locale")
     parts.append("void set_locale(const char* loc) {")
-    parts.append("  i18n_set_locale_internal(loc);")
+    parts.append("  if (locale_handler) {")
+    parts.append("    locale_handler(loc);")
+    parts.append("  } else {")
+    parts.append("    i18n_set_locale_internal(loc);")
+    parts.append("  }")
     parts.append("}\n")
 
     # Public locale getter
     parts.append("// Get current locale")
     parts.append("const char* get_locale() {")
-    parts.append("  return current_loc;")
+    parts.append("  return I18N_LOCALE_CODES[current_loc.load(std::memory_order_acquire)];")
     parts.append("}\n")
 
     parts.append("} // namespace i18n")
@@ -293,6 +2373,170 @@ def _gen_translations_cpp(locales_map: dict[str, dict[str, str]], default_locale
 
     return "\n".join(parts)
 
+# ------------------ Write Locale Blobs ------------------
+
+def _write_bytes_if_changed(path: Path, data: bytes) -> None:
+    """Write binary data, keeping the file (and its timestamp) if nothing changed."""
+    if path.is_file() and path.read_bytes() == data:
+        return
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_bytes(data)
+
+def _write_locale_outputs(
+    locales_map: dict[str, dict[str, str]], all_keys: list[str], layout: dict | None, partition: str | None
+) -> None:
+    """
+    Write what is built per locale, one locale at a time: its translations_<locale>.cpp
+    when split (layout from _gen_translations_cpp()), its blob and its part of the
+    partition image with storage: partition, and its glyph manifest.
+
+    Each locale's map is taken out of locales_map before its outputs are built, so
+    only one locale's texts and outputs are alive at a time; locales_map ends up empty.
+    The partition image goes to the data partition, e.g. with
+    `esptool.py write_flash <partition offset> i18n/<partition>.bin`.
+    """
+    locales = sorted(locales_map)
+    symbols = dict(zip(locales, _locale_symbols(locales)))
+    gen_dir = Path(CORE.relative_src_path("generated"))
+    out_dir = Path(CORE.relative_build_path("i18n"))
+    # The fingerprint covers the templates of every locale, so it is taken first
+    keys_hash = _keys_hash(locales_map, all_keys) if partition is not None else 0
+    image_path = out_dir / f"{partition}.bin"
+    image = _PartitionImage(image_path, locales, keys_hash) if partition is not None else contextlib.nullcontext()
+
+    with image:
+        for loc in locales:
+            flat = locales_map.pop(loc)
+            texts = [flat[k] for k in all_keys]
+            if layout is not None:
+                write_file_if_changed(gen_dir / f"translations_{loc}.cpp", _gen_locale_unit(loc, symbols[loc], texts, layout))
+            if partition is not None:
+                blob = _build_locale_blob(texts, keys_hash)
+                _write_bytes_if_changed(out_dir / f"{loc}.bin", blob)
+                image.add(loc, blob)
+            # The characters the locale renders, e.g. for lv_font_conv --symbols
+            glyphs = "".join(sorted(_locale_glyphs(flat))) + "\n"
+            _write_bytes_if_changed(out_dir / f"glyphs_{loc}.txt", glyphs.encode("utf-8"))
+            del flat, texts
+
+    # Units of removed locales or an unsplit build go away
+    units = {f"translations_{loc}.cpp" for loc in locales} if layout is not None else set()
+    for stale in gen_dir.glob("translations_*.cpp"):
+        if stale.name not in units:
+            stale.unlink()
+    if partition is not None:
+        _LOGGER.info(
+            "i18n partition image: %d locales in %d bytes, flash %s to the '%s' data partition",
+            len(locales), image.size, image_path, partition,
+        )
+
+# ------------------ Build Cache ------------------
+
+# Cache files kept in .esphome/i18n_cache, shared by all configurations of a directory
+_CACHE_LIMIT = 64
+
+def _cache_dir() -> Path:
+    return Path(CORE.data_dir) / "i18n_cache"
+
+def _digest(*parts) -> str:
+    """Hash of this generator's code and the given JSON-serializable parts."""
+    h = hashlib.sha256(Path(__file__).read_bytes())
+    for part in parts:
+        # Maps are encoded one entry (one locale) at a time, large catalogs never exist as one JSON string
+        items = sorted(part.items()) if isinstance(part, dict) else [(None, part)]
+        for name, value in items:
+            h.update(json.dumps([name, value], sort_keys=True, ensure_ascii=False).encode("utf-8"))
+    return h.hexdigest()[:32]
+
+def _cache_get(name: str):
+    path = _cache_dir() / name
+    try:
+        value = json.loads(path.read_text(encoding="utf-8"))
+    except (OSError, ValueError):
+        return None
+    # Eviction goes by mtime, so a hit counts as a use
+    with contextlib.suppress(OSError):
+        os.utime(path)
+    return value
+
+class _LogCapture(logging.Handler):
+    """Collects what _LOGGER reports while an entry is built, so cache hits can report it again."""
+
+    def __init__(self):
+        super().__init__(logging.INFO)
+        self.records: list[list] = []
+
+    def emit(self, record):
+        self.records.append([record.levelno, record.getMessage()])
+
+@contextlib.contextmanager
+def _captured_log():
+    handler = _LogCapture()
+    _LOGGER.addHandler(handler)
+    try:
+        yield handler.records
+    finally:
+        _LOGGER.removeHandler(handler)
+
+def _replay_log(records: list[list]) -> None:
+    for level, message in records:
+        _LOGGER.log(level, "%s", message)
+
+def _cache_put(name: str, value) -> None:
+    """Store atomically, parallel builds may share the directory; drop the oldest entries."""
+    cache = _cache_dir()
+    try:
+        cache.mkdir(parents=True, exist_ok=True)
+        fd, tmp = tempfile.mkstemp(dir=cache, suffix=".tmp")
+        with os.fdopen(fd, "w", encoding="utf-8") as f:
+            json.dump(value, f, ensure_ascii=False)
+        os.replace(tmp, cache / name)
+        entries = sorted(cache.glob("*.json"), key=lambda p: p.stat().st_mtime, reverse=True)
+        for old in entries[_CACHE_LIMIT:]:
+            old.unlink(missing_ok=True)
+    except OSError as err:
+        _LOGGER.debug("i18n cache not written: %s", err)
+
+def _load_locales_cached(sources: list[Path]) -> tuple[dict[str, dict[str, str]], dict[str, list[str]]]:
+    """_load_locales(), reused while the source files are unchanged."""
+    try:
+        # The locale comes from the file name, the directory does not matter
+        contents = [[src.name, hashlib.sha256(src.read_bytes()).hexdigest()] for src in sources]
+    except OSError:
+        return _load_locales(sources)
+    name = f"sources-{_digest(contents)}.json"
+    cached = _cache_get(name)
+    if cached is not None:
+        _replay_log(cached["log"])
+        return cached["locales"], cached["plurals"]
+    with _captured_log() as log:
+        locales_map, plurals = _load_locales(sources)
+    _cache_put(name, {"locales": locales_map, "plurals": plurals, "log": log})
+    return locales_map, plurals
+
+def _prune_config_keys(
+    config, full_config, locales_map: dict[str, dict[str, str]], plurals: dict[str, list[str]], quiet: bool = False
+) -> set[str]:
+    """Apply prune_keys to the loaded locales, returns the remaining keys."""
+    all_keys = sorted(set().union(*(flat.keys() for flat in locales_map.values())))
+    code: list[str] = []
+    _lambda_sources(full_config, code)
+    for include in full_config.get("esphome", {}).get("includes", []):
+        path = Path(CORE.relative_config_path(str(include)))
+        if path.is_file():
+            code.append(path.read_text(encoding="utf-8", errors="replace"))
+    strings: set[str] = set()
+    _config_strings(full_config, strings)
+    bound = [b["key"] for b in config["bindings"]]
+    used = _used_keys(all_keys, code, bound, config["keep"], strings, quiet)
+    _prune_keys(locales_map, plurals, used)
+    remaining = set().union(*(flat.keys() for flat in locales_map.values()))
+    if not remaining:
+        raise cv.Invalid(
+            f"prune_keys: all {len(all_keys)} keys pruned, no lambda, binding, action or keep pattern uses one"
+        )
+    return remaining
+
 # ------------------ Main Code Generator ------------------
 
 async def to_code(config):
@@ -309,48 +2553,120 @@ async def to_code(config):
     # Define for conditional compilation
     cg.add_define("USE_I18N")
 
+    # Locale change automations, "x" is the new locale code
+    for conf in config.get("on_locale_change", []):
+        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
+        await automation.build_automation(trigger, [(cg.std_string, "x")], conf)
+
     default_locale: str = config["default_locale"]
     sources = [Path(CORE.relative_config_path(p)) for p in config["sources"]]
 
-    # Load and process all locale files
-    locales_map: dict[str, dict[str, str]] = {}
+    # Load and process all locale files, flattened maps are cached by source content
+    locales_map, plurals = _load_locales_cached(sources)
+    _apply_fallbacks(locales_map, config["fallback"])
     all_keys_set = set()
-
-    for src in sources:
-        if not src.exists():
-            raise cv.Invalid(f"Locale file not found: {src}")
-        
-        # Locale name from filename (e.g., "en.yaml" -> "en")
-        loc = src.stem
-        
-        # Load and flatten YAML structure
-        data = _load_yaml_file(src)
-        flat = {}
-        _flatten_dict("", data, flat)
-
-        if loc in locales_map:
-            _LOGGER.info("Updating locale %s (possibly overwriting) from %s", loc, src)
-            locales_map[loc].update(flat)
-        else:
-            locales_map[loc] = flat
+    for flat in locales_map.values():
         all_keys_set.update(flat.keys())
 
+    # Dead-key elimination: only keys the configuration can reach are compiled in
+    if config["prune_keys"]:
+        total = len(all_keys_set)
+        all_keys_set = _prune_config_keys(config, CORE.config, locales_map, plurals)
+        _LOGGER.info("i18n prune_keys: %d of %d keys are used", len(all_keys_set), total)
+
     all_keys = sorted(all_keys_set)
 
     # Validate default locale exists
     if default_locale not in locales_map:
         raise cv.Invalid(f"default_locale='{default_locale}' not found in sources")
 
+    # Bind LVGL labels to their keys (label pointers are resolved after LVGL setup)
+    for binding in config["bindings"]:
+        if binding["key"] not in all_keys_set:
+            raise cv.Invalid(f"Binding for label '{binding['label']}' uses unknown key '{binding['key']}'")
+        label = await cg.get_variable(binding["label"])
+        key_id = cg.RawExpression(f"esphome::i18n::Key::{_sym_from_key(binding['key'])}")
+        cg.add(var.bind(cg.RawExpression(f"&{label}"), key_id))
+
     # Generate C++ files
     gen_dir = CORE.relative_src_path("generated")
     hdr_path = Path(gen_dir) / "translations.h"
     cpp_path = Path(gen_dir) / "translations.cpp"
 
-    hdr = _gen_translations_h(all_keys)
-    cpp = _gen_translations_cpp(locales_map, default_locale, all_keys)
+    if config["prefetch"]:
+        cg.add(var.set_prefetch(config["prefetch"]))
+
+    if catalog := config.get("catalog"):
+        cg.add_define("USE_I18N_CATALOG")
+        server = await cg.get_variable(catalog[web_server_base.CONF_WEB_SERVER_BASE_ID])
+        handler = cg.new_Pvariable(catalog[CONF_ID], var, server)
+        await cg.register_component(handler, catalog)
+        cg.add(handler.set_page_size(catalog["page_size"]))
+
+    if overrides := config.get("overrides"):
+        # The arena is a fixed member of the component, sized at compile time
+        cg.add_define("USE_I18N_OVERRIDES")
+        cg.add_define("I18N_OVERRIDE_ARENA_SIZE", overrides["arena_size"])
+        cg.add(var.set_restore_overrides(overrides["restore"]))
+
+    compression: str = config["compression"]
+    if compression != "none":
+        cg.add(var.set_cache_size(config["cache_size"]))
+
+    partition = config["partition"] if config["storage"] == "partition" else None
+
+    # Configurations with the same tables and options share the generated files
+    split = config["split_locales"]
+    options = [default_locale, config["key_lookup"], compression, partition, config["statistics"], split]
+    output_name = f"output-{_digest(locales_map, plurals, options)}.json"
+    if "max_string_length" in config:
+        _check_string_length(locales_map, config["max_string_length"])
+    cached = _cache_get(output_name)
+    if cached is not None:
+        hdr, cpp, layout, footprint = cached["h"], cached["cpp"], cached["layout"], cached["footprint"]
+        # Warnings of the generator, such as the perfect hash fallback, are reported on every build
+        _replay_log(cached["log"])
+    else:
+        layout = {} if split else None
+        footprint = {}
+        with _captured_log() as log:
+            # The C++ source is generated first, it validates the locale sources
+            cpp = _gen_translations_cpp(
+                locales_map,
+                default_locale,
+                all_keys,
+                config["key_lookup"],
+                compression,
+                partition,
+                plurals,
+                config["statistics"],
+                layout,
+                footprint,
+            )
+            hdr = _gen_translations_h(
+                all_keys,
+                _max_string_len(locales_map),
+                sorted(locales_map.keys()),
+                default_locale,
+                compression,
+                partition,
+                _format_templates(locales_map, default_locale, all_keys, plurals),
+                config["statistics"],
+            )
+        _cache_put(output_name, {"h": hdr, "cpp": cpp, "layout": layout, "footprint": footprint, "log": log})
+
+    _log_footprint(footprint)
+    if "max_flash_bytes" in config and _footprint_totals(footprint) > config["max_flash_bytes"]:
+        raise cv.Invalid(
+            f"Translations take {_footprint_totals(footprint)} bytes of flash, more than "
+            f"max_flash_bytes={config['max_flash_bytes']}; see the i18n footprint in the log"
+        )
 
     write_file_if_changed(hdr_path, hdr)
     write_file_if_changed(cpp_path, cpp)
+    # Last use of the texts: units, blobs and glyphs are written and released locale by locale.
+    # Only rewritten units are recompiled.
+    _write_locale_outputs(locales_map, all_keys, layout, partition)
 
     # Build flags
     cg.add_build_flag("-Isrc")
@@ -4,6 +4,7 @@
 
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include <algorithm>
 #include <cstring>
 
 namespace esphome {
@@ -19,84 +20,746 @@ void I18nComponent::setup() {
 
   // Set global pointer for easy access
   global_i18n_component = this;
+  // set_locale() from lambdas goes through the component, so there is one way to switch
+  esphome::i18n::i18n_set_locale_handler_internal(
+      [](const char *locale) { global_i18n_component->set_current_locale(locale); });
 
   // Initialize with default locale
   const char *default_loc = esphome::i18n::TRANSLATIONS_DEFAULT_LOCALE;
-  esphome::i18n::set_locale(default_loc);
-  this->current_locale_ = std::string(default_loc);
+  if (!esphome::i18n::i18n_set_locale_index_internal(static_cast<Locale>(esphome::i18n::I18N_DEFAULT_LOCALE_INDEX))) {
+    ESP_LOGE(TAG, "Default locale '%s' could not be loaded, translations are empty", default_loc);
+    this->status_set_error();
+  }
+
+#ifdef USE_I18N_OVERRIDES
+  if (this->restore_overrides_) {
+    this->override_pref_ = global_preferences->make_preference<OverrideStore>(fnv1_hash("i18n_overrides"));
+    // Key and locale IDs of another firmware mean something else, drop its overrides
+    if (!this->override_pref_.load(&this->overrides_) || this->overrides_.layout != esphome::i18n::I18N_LAYOUT_HASH ||
+        this->overrides_.used > sizeof(this->overrides_.arena))
+      this->overrides_.used = 0;
+    else if (this->overrides_.used != 0)
+      ESP_LOGCONFIG(TAG, "Restored %u bytes of translation overrides", (unsigned) this->overrides_.used);
+  }
+#endif
+
+#if I18N_COMPRESSED
+  // Allocated once here, lookups from other tasks never see the cache being built
+  this->cache_.assign(this->cache_size_, CacheEntry{0, 0, 0, 0});
+  this->cache_text_.resize(this->cache_size_ * (esphome::i18n::I18N_MAX_LEN + 1));
+#endif
 
   ESP_LOGCONFIG(TAG, "I18N setup complete. Default locale: %s", default_loc);
 }
 
+void I18nComponent::loop() {
+  // Label pointers from YAML bindings are assigned during LVGL setup
+  if (!this->pending_bindings_.empty()) {
+    for (const auto &pending : this->pending_bindings_) {
+      if (*pending.ref != nullptr) {
+        this->bind(*pending.ref, static_cast<Key>(pending.key));
+      } else {
+        ESP_LOGW(TAG, "Bound label for key id=%u was never created, skipping", (unsigned) pending.key);
+      }
+    }
+    this->pending_bindings_.clear();
+    this->pending_bindings_.shrink_to_fit();
+  }
+
+  // Warm up the new locale a few keys at a time, so no single loop() stalls
+  if (this->prefetch_pos_ < this->prefetch_queue_.size())
+    this->prefetch_step_();
+
+  if (this->stale_count_ == 0)
+    return;
+
+  // Refresh labels lazily once their screen gets loaded
+  lv_obj_t *active = lv_scr_act();
+  if (active == this->last_screen_)
+    return;
+  this->last_screen_ = active;
+
+  for (auto &binding : this->bindings_) {
+    if (binding.stale && is_visible_(binding.obj, active)) {
+      this->apply_binding_(binding);
+      binding.stale = false;
+      this->stale_count_--;
+    }
+  }
+}
+
 void I18nComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "I18N Component");
-  ESP_LOGCONFIG(TAG, "  Current locale: %s", this->get_current_locale().c_str());
+  ESP_LOGCONFIG(TAG, "  Current locale: %s", this->locale_code());
+  ESP_LOGCONFIG(TAG, "  Available locales: %zu", esphome::i18n::I18N_LOCALE_COUNT);
   ESP_LOGCONFIG(TAG, "  Available translations: %zu keys", esphome::i18n::I18N_KEY_COUNT);
+  const auto &fp = esphome::i18n::I18N_FOOTPRINT;
+  ESP_LOGCONFIG(TAG, "  Flash: %u bytes (strings %u, tables %u, keys %u), %u bytes saved by dedup/compression",
+                (unsigned) (fp.strings + fp.tables + fp.keys), (unsigned) fp.strings, (unsigned) fp.tables,
+                (unsigned) fp.keys, (unsigned) fp.saved);
+  ESP_LOGCONFIG(TAG, "  Bound labels: %zu", this->bindings_.size() + this->pending_bindings_.size());
+#if I18N_EXTERNAL_STORAGE
+  ESP_LOGCONFIG(TAG, "  Storage: data partition '%s' (%u bytes of locale blobs)", esphome::i18n::I18N_PARTITION_LABEL,
+                (unsigned) fp.partition);
+#endif
+#if I18N_COMPRESSED
+  uint32_t lookups = this->cache_hits_ + this->cache_misses_;
+  ESP_LOGCONFIG(TAG, "  Compressed strings, decoded-string cache: %zu entries (%zu bytes)", this->cache_size_,
+                this->cache_size_ * (esphome::i18n::I18N_MAX_LEN + 1));
+  ESP_LOGCONFIG(TAG, "  Cache hit rate: %.1f%% (%u hits, %u misses)",
+                lookups ? 100.0f * this->cache_hits_ / lookups : 0.0f, (unsigned) this->cache_hits_,
+                (unsigned) this->cache_misses_);
+#endif
+#ifdef USE_I18N_OVERRIDES
+  ESP_LOGCONFIG(TAG, "  Overrides: %u of %u bytes used%s", (unsigned) this->overrides_.used,
+                (unsigned) sizeof(this->overrides_.arena), this->restore_overrides_ ? ", restored on boot" : "");
+#endif
+#if I18N_STATISTICS
+  this->dump_statistics_();
+#endif
+}
+
+#if I18N_STATISTICS
+void I18nComponent::dump_statistics_() {
+  const auto &stats = esphome::i18n::i18n_stats;
+  ESP_LOGCONFIG(TAG, "  Lookups: %u, missing keys: %u, time: %u us (%.2f us per lookup)", (unsigned) stats.lookups,
+                (unsigned) stats.misses, (unsigned) stats.micros,
+                stats.lookups ? static_cast<float>(stats.micros) / stats.lookups : 0.0f);
+
+  // Hottest keys, a few passes over the counters are fine for a config dump
+  static constexpr size_t HOT_KEYS = 5;
+  uint32_t below = UINT16_MAX + 1u;
+  size_t shown = 0;
+  while (shown < HOT_KEYS) {
+    uint16_t top = 0;
+    for (size_t i = 0; i < esphome::i18n::I18N_KEY_COUNT; ++i) {
+      if (stats.hits[i] < below && stats.hits[i] > top)
+        top = stats.hits[i];
+    }
+    if (top == 0)
+      break;
+    for (size_t i = 0; i < esphome::i18n::I18N_KEY_COUNT && shown < HOT_KEYS; ++i) {
+      if (stats.hits[i] == top) {
+        ESP_LOGCONFIG(TAG, "    Hot key: %s (%u%s)", esphome::i18n::i18n_key_name_internal(static_cast<Key>(i)),
+                      (unsigned) top, top == UINT16_MAX ? "+" : "");
+        shown++;
+      }
+    }
+    below = top;
+  }
 
-  // Verify internal state matches
-  const char *internal_locale = esphome::i18n::get_locale();
-  ESP_LOGCONFIG(TAG, "  Internal locale: %s", internal_locale ? internal_locale : "NULL");
+  // Keys never looked up since boot are candidates for pruning
+  static constexpr size_t UNUSED_SHOWN = 10;
+  size_t unused = unused_key_count();
+  ESP_LOGCONFIG(TAG, "  Unused keys: %zu of %zu", unused, esphome::i18n::I18N_KEY_COUNT);
+  size_t listed = 0;
+  for (size_t i = 0; i < esphome::i18n::I18N_KEY_COUNT && listed < UNUSED_SHOWN; ++i) {
+    if (stats.hits[i] == 0) {
+      ESP_LOGCONFIG(TAG, "    %s", esphome::i18n::i18n_key_name_internal(static_cast<Key>(i)));
+      listed++;
+    }
+  }
+  if (unused > listed)
+    ESP_LOGCONFIG(TAG, "    ... and %zu more", unused - listed);
 }
 
-void I18nComponent::set_current_locale(const std::string &locale) {
+size_t I18nComponent::unused_key_count() {
+  size_t unused = 0;
+  for (size_t i = 0; i < esphome::i18n::I18N_KEY_COUNT; ++i) {
+    if (esphome::i18n::i18n_stats.hits[i] == 0)
+      unused++;
+  }
+  return unused;
+}
+#endif
+
+void I18nComponent::set_current_locale(const char *locale) {
+  if (locale == nullptr)
+    locale = "";
+  // Resolve the name once here, lookups only use the index
+  int idx = esphome::i18n::i18n_locale_index_internal(locale);
+  if (idx < 0) {
+    ESP_LOGW(TAG, "Unknown locale '%s', keeping '%s'", locale, this->locale_code());
+    return;
+  }
+
   // Only change if different to avoid unnecessary updates
-  if (this->current_locale_ != locale) {
-    ESP_LOGI(TAG, "Changing locale from '%s' to '%s'", this->current_locale_.c_str(), locale.c_str());
-    
-    // Update internal state FIRST
-    this->current_locale_ = locale;
-    esphome::i18n::set_locale(this->current_locale_.c_str());
-    
-    // Verify it was set correctly
-    const char *new_locale = esphome::i18n::get_locale();
-    ESP_LOGD(TAG, "Locale changed successfully. Internal locale is now: %s", new_locale);
-    
-    // TODO: Trigger UI update event for LVGL labels
-    // This would allow automatic label updates without manual refresh
+  Locale previous = this->locale_();
+  if (previous != static_cast<Locale>(idx)) {
+    // A single atomic store, lookups on other tasks see either the old or the new locale.
+    // With partition storage this maps the new locale first.
+    if (!esphome::i18n::i18n_set_locale_index_internal(static_cast<Locale>(idx))) {
+      ESP_LOGW(TAG, "Locale '%s' could not be loaded, keeping '%s'", locale, this->locale_code());
+      return;
+    }
+    ESP_LOGI(TAG, "Changing locale from '%s' to '%s'", esphome::i18n::I18N_LOCALE_CODES[(size_t) previous], locale);
+
+    // Update bound LVGL labels
+    this->refresh_bindings_();
+    if (this->prefetch_chunk_ != 0)
+      this->start_prefetch_();
+
+    // Notify listeners once per switch
+    this->locale_change_callback_.call(std::string(this->locale_code()));
   } else {
-    ESP_LOGV(TAG, "Locale already set to '%s', skipping", locale.c_str());
+    ESP_LOGV(TAG, "Locale already set to '%s', skipping", locale);
+  }
+}
+
+void I18nComponent::start_prefetch_() {
+  this->prefetch_queue_.clear();
+  this->prefetch_pos_ = 0;
+
+  // Recently viewed keys first, newest first, they are likely needed by the next frame
+  for (size_t i = 1; i <= PREFETCH_RECENT; ++i) {
+    uint16_t entry = this->recent_[(this->recent_pos_ + PREFETCH_RECENT - i) % PREFETCH_RECENT];
+    if (entry != 0)
+      this->prefetch_queue_.push_back(entry - 1);
+  }
+  // Then labels on inactive screens, those on the active one were just set
+  size_t recent = this->prefetch_queue_.size();
+  for (const auto &binding : this->bindings_) {
+    if (binding.stale &&
+        std::find(this->prefetch_queue_.begin(), this->prefetch_queue_.begin() + recent, binding.key) ==
+            this->prefetch_queue_.begin() + recent)
+      this->prefetch_queue_.push_back(binding.key);
+  }
+#if I18N_COMPRESSED
+  // Decoding more keys than the cache holds would evict the first ones again
+  if (this->prefetch_queue_.size() > this->cache_size_)
+    this->prefetch_queue_.resize(this->cache_size_);
+#endif
+  ESP_LOGV(TAG, "Warming up %zu keys", this->prefetch_queue_.size());
+}
+
+void I18nComponent::prefetch_step_() {
+#if !I18N_COMPRESSED
+  // One read per flash cache line is enough to pull a string in
+  static constexpr size_t CACHE_LINE = 32;
+  static volatile uint8_t sink;
+#endif
+  Locale locale = this->locale_();
+  size_t end = std::min(this->prefetch_pos_ + this->prefetch_chunk_, this->prefetch_queue_.size());
+  for (; this->prefetch_pos_ < end; ++this->prefetch_pos_) {
+    Key key = static_cast<Key>(this->prefetch_queue_[this->prefetch_pos_]);
+#if I18N_COMPRESSED
+    // Decoding puts the string into the cache, its text is not read here
+    this->cached_(locale, key, nullptr);
+#else
+    // Reading one byte per cache line pulls the string in from flash
+    size_t len = 0;
+    const char *p = this->view_(locale, key, &len);
+    for (size_t i = 0; i < len; i += CACHE_LINE)
+      sink = sink + static_cast<uint8_t>(p[i]);
+#endif
+  }
+  if (this->prefetch_pos_ == this->prefetch_queue_.size()) {
+    this->prefetch_queue_.clear();
+    this->prefetch_queue_.shrink_to_fit();
+    this->prefetch_pos_ = 0;
+  }
+}
+
+#ifdef USE_I18N_OVERRIDES
+bool I18nComponent::set_override(const std::string &key, const std::string &text, const std::string &locale) {
+  int idx = esphome::i18n::i18n_key_index_internal(key.c_str());
+  int loc = locale.empty() ? static_cast<int>(this->locale_()) : esphome::i18n::i18n_locale_index_internal(locale.c_str());
+  if (idx < 0 || loc < 0) {
+    ESP_LOGW(TAG, "Cannot override unknown key '%s' or locale '%s'", key.c_str(), locale.c_str());
+    return false;
+  }
+  return this->set_override(static_cast<Key>(idx), static_cast<Locale>(loc), text.data(), text.size());
+}
+
+bool I18nComponent::set_override(Key key, Locale locale, const char *text, size_t len) {
+  if (static_cast<size_t>(key) >= esphome::i18n::I18N_KEY_COUNT ||
+      static_cast<size_t>(locale) >= esphome::i18n::I18N_LOCALE_COUNT || (text == nullptr && len != 0))
+    return false;
+  uint32_t want = (static_cast<uint32_t>(key) << 8) | static_cast<uint8_t>(locale);
+  {
+    LockGuard guard(this->override_lock_);
+    uint8_t *arena = this->overrides_.arena;
+    // Find the insertion point and the size of the record it replaces, if any
+    size_t pos = 0;
+    size_t old_size = 0;
+    while (pos < this->overrides_.used) {
+      const auto *rec = reinterpret_cast<const OverrideRecord *>(arena + pos);
+      uint32_t have = (static_cast<uint32_t>(rec->key) << 8) | rec->locale;
+      if (have >= want) {
+        if (have == want)
+          old_size = override_size_(rec->len);
+        break;
+      }
+      pos += override_size_(rec->len);
+    }
+
+    size_t new_size = override_size_(len);
+    size_t used = this->overrides_.used - old_size + new_size;
+    if (used > sizeof(this->overrides_.arena)) {
+      ESP_LOGW(TAG, "Override for key id=%u does not fit, %u of %u bytes used", (unsigned) key,
+               (unsigned) this->overrides_.used, (unsigned) sizeof(this->overrides_.arena));
+      return false;
+    }
+    // Move the following records, then write this one in place
+    memmove(arena + pos + new_size, arena + pos + old_size, this->overrides_.used - pos - old_size);
+    auto *rec = reinterpret_cast<OverrideRecord *>(arena + pos);
+    *rec = OverrideRecord{static_cast<uint16_t>(key), static_cast<uint16_t>(locale), static_cast<uint16_t>(len)};
+    char *dst = reinterpret_cast<char *>(rec + 1);
+    if (len != 0)
+      memcpy(dst, text, len);
+    dst[len] = '\0';
+    this->overrides_.used = used;
+  }
+  this->overrides_changed_(locale);
+  return true;
+}
+
+void I18nComponent::clear_override(const std::string &key, const std::string &locale) {
+  int idx = esphome::i18n::i18n_key_index_internal(key.c_str());
+  int loc = locale.empty() ? static_cast<int>(this->locale_()) : esphome::i18n::i18n_locale_index_internal(locale.c_str());
+  if (idx < 0 || loc < 0)
+    return;
+  uint32_t want = (static_cast<uint32_t>(idx) << 8) | static_cast<uint8_t>(loc);
+  {
+    LockGuard guard(this->override_lock_);
+    uint8_t *arena = this->overrides_.arena;
+    for (size_t pos = 0; pos < this->overrides_.used;) {
+      const auto *rec = reinterpret_cast<const OverrideRecord *>(arena + pos);
+      uint32_t have = (static_cast<uint32_t>(rec->key) << 8) | rec->locale;
+      size_t size = override_size_(rec->len);
+      if (have > want)
+        return;
+      if (have == want) {
+        memmove(arena + pos, arena + pos + size, this->overrides_.used - pos - size);
+        this->overrides_.used -= size;
+        break;
+      }
+      pos += size;
+    }
+  }
+  this->overrides_changed_(static_cast<Locale>(loc));
+}
+
+void I18nComponent::clear_overrides() {
+  if (this->overrides_.used == 0)
+    return;
+  {
+    LockGuard guard(this->override_lock_);
+    this->overrides_.used = 0;
+  }
+  this->overrides_changed_(this->locale_());
+}
+
+const char *I18nComponent::find_override_(Locale locale, Key key, size_t *len) const {
+  uint32_t want = (static_cast<uint32_t>(key) << 8) | static_cast<uint8_t>(locale);
+  for (size_t pos = 0; pos < this->overrides_.used;) {
+    const auto *rec = reinterpret_cast<const OverrideRecord *>(this->overrides_.arena + pos);
+    uint32_t have = (static_cast<uint32_t>(rec->key) << 8) | rec->locale;
+    if (have > want)
+      break;
+    if (have == want) {
+      if (len)
+        *len = rec->len;
+      return reinterpret_cast<const char *>(rec + 1);
+    }
+    pos += override_size_(rec->len);
+  }
+  return nullptr;
+}
+
+void I18nComponent::overrides_changed_(Locale locale) {
+  ESP_LOGD(TAG, "Overrides changed, %u of %u bytes used", (unsigned) this->overrides_.used,
+           (unsigned) sizeof(this->overrides_.arena));
+  if (this->restore_overrides_) {
+    // A burst of changes, like a service patching a whole screen, is written to flash once
+    this->overrides_dirty_ = true;
+    this->set_timeout("i18n_overrides", OVERRIDE_SAVE_DELAY_MS, [this]() { this->save_overrides_(); });
+  }
+  if (locale == this->locale_())
+    this->refresh_bindings_();
+}
+
+void I18nComponent::save_overrides_() {
+  if (!this->overrides_dirty_)
+    return;
+  this->overrides_dirty_ = false;
+  this->overrides_.layout = esphome::i18n::I18N_LAYOUT_HASH;
+  this->override_pref_.save(&this->overrides_);
+}
+#endif
+
+void I18nComponent::on_shutdown() {
+#ifdef USE_I18N_OVERRIDES
+  // Changes still waiting for the delayed save
+  if (this->overrides_dirty_) {
+    this->save_overrides_();
+    global_preferences->sync();
   }
+#endif
 }
 
-std::string I18nComponent::get_current_locale() {
-  // Always sync with internal state
-  const char *internal_locale = esphome::i18n::get_locale();
-  if (internal_locale) {
-    std::string internal_str(internal_locale);
-    if (this->current_locale_ != internal_str) {
-      ESP_LOGW(TAG, "Locale mismatch! Component: '%s', Internal: '%s'. Syncing...", 
-               this->current_locale_.c_str(), internal_locale);
-      this->current_locale_ = internal_str;
+const char *I18nComponent::translate_into(Locale locale, Key key, char *buf, size_t n, size_t *len) {
+#ifdef USE_I18N_OVERRIDES
+  if (this->overrides_.used != 0) {
+    LockGuard guard(this->override_lock_);
+    size_t full = 0;
+    if (const char *p = this->find_override_(locale, key, &full)) {
+      // Overrides move when others change, they are only handed out as copies
+      if (buf == nullptr || n == 0)
+        return nullptr;
+      size_t copy = std::min(full, n - 1);
+      memcpy(buf, p, copy);
+      buf[copy] = '\0';
+      if (len)
+        *len = copy;
+      return buf;
     }
   }
-  return this->current_locale_;
+#endif
+#if I18N_ZERO_COPY && !I18N_EXTERNAL_STORAGE
+  // Flash pointers need no buffer and are safe from any task
+  (void) buf;
+  (void) n;
+  return esphome::i18n::i18n_get_view_internal(locale, key, len);
+#else
+  size_t full = esphome::i18n::i18n_get_buf_internal(locale, key, buf, n);
+  if (len)
+    *len = std::min(full, n - 1);
+  return buf;
+#endif
+}
+
+uint32_t I18nComponent::catalog_version(Locale locale) {
+  uint32_t version = esphome::i18n::I18N_LOCALE_HASHES[static_cast<size_t>(locale)];
+#ifdef USE_I18N_OVERRIDES
+  LockGuard guard(this->override_lock_);
+  // FNV-1a over the records, overrides of other locales change it too which only costs a refetch
+  for (size_t i = 0; i < this->overrides_.used; ++i)
+    version = (version ^ this->overrides_.arena[i]) * 16777619u;
+#endif
+  return version;
 }
 
 std::string I18nComponent::translate(const std::string &key) {
-  // Get current locale
-  const char *current_loc = this->current_locale_.c_str();
-  
-  ESP_LOGVV(TAG, "Translating key='%s' with locale='%s'", key.c_str(), current_loc);
-  
-  // Use a local buffer to avoid static caching
-  char buf[256];
-  esphome::i18n::i18n_get_buf_internal(current_loc, key.c_str(), buf, sizeof(buf));
-  
-  ESP_LOGVV(TAG, "Translation result: '%s'", buf);
-  
-  return std::string(buf);
+  ESP_LOGVV(TAG, "Translating key='%s' with locale='%s'", key.c_str(), this->locale_code());
+
+  int idx = esphome::i18n::i18n_key_index_internal(key.c_str());
+  if (idx < 0) {
+    // Key not found - return key itself as fallback
+    this->count_miss_();
+    return key;
+  }
+  return this->translate_(this->locale_(), static_cast<Key>(idx));
 }
 
 std::string I18nComponent::translate(const std::string &key, const std::string &locale) {
   ESP_LOGVV(TAG, "Translating key='%s' with explicit locale='%s'", key.c_str(), locale.c_str());
-  
-  // Use a local buffer
-  char buf[256];
-  esphome::i18n::i18n_get_buf_internal(locale.c_str(), key.c_str(), buf, sizeof(buf));
-  
-  ESP_LOGVV(TAG, "Translation result: '%s'", buf);
-  
-  return std::string(buf);
+
+  int idx = esphome::i18n::i18n_key_index_internal(key.c_str());
+  if (idx < 0) {
+    this->count_miss_();
+    return key;
+  }
+  return this->translate_(resolve_locale_(locale), static_cast<Key>(idx));
+}
+
+std::string I18nComponent::translate(Key key) {
+  ESP_LOGVV(TAG, "Translating key id=%u with locale='%s'", (unsigned) key, this->locale_code());
+  return this->translate_(this->locale_(), key);
+}
+
+std::string I18nComponent::translate(Key key, const std::string &locale) {
+  ESP_LOGVV(TAG, "Translating key id=%u with explicit locale='%s'", (unsigned) key, locale.c_str());
+  return this->translate_(resolve_locale_(locale), key);
+}
+
+std::string I18nComponent::translate(Key key, Locale locale) { return this->translate_(locale, key); }
+
+std::string I18nComponent::translate_plural(Key key, int32_t n) {
+  uint32_t count = n < 0 ? 0u - static_cast<uint32_t>(n) : static_cast<uint32_t>(n);
+  return this->translate_(this->locale_(), esphome::i18n::i18n_plural_key_internal(this->locale_(), key, count));
+}
+
+Locale I18nComponent::resolve_locale_(const std::string &locale) {
+  int idx = esphome::i18n::i18n_locale_index_internal(locale.c_str());
+  // Unknown locales fall back to the default one
+  return static_cast<Locale>(idx < 0 ? esphome::i18n::I18N_DEFAULT_LOCALE_INDEX : idx);
+}
+
+std::string I18nComponent::translate_(Locale locale, Key key) {
+#ifdef USE_I18N_OVERRIDES
+  if (this->overrides_.used != 0) {
+    // Other tasks may translate while the main loop changes overrides
+    LockGuard guard(this->override_lock_);
+    size_t len = 0;
+    if (const char *p = this->find_override_(locale, key, &len))
+      return std::string(p, len);
+  }
+#endif
+#if I18N_COMPRESSED
+  // Copy out while holding the cache, other tasks may evict the slot right after
+  LockGuard guard(this->cache_lock_);
+  size_t len = 0;
+  const char *p = this->cached_locked_(locale, key, &len);
+  return std::string(p, len);
+#elif I18N_ZERO_COPY && !I18N_EXTERNAL_STORAGE
+  // Build the string straight from flash, no intermediate buffer
+  size_t len = 0;
+  const char *p = this->view_(locale, key, &len);
+  return std::string(p, len);
+#else
+  // Size the string from the length table, then copy the PROGMEM or partition bytes into it.
+  // Partition locales that are not mapped are read straight into it, no state is shared with other tasks
+  std::string result(esphome::i18n::i18n_get_buf_internal(locale, key, nullptr, 0), '\0');
+  esphome::i18n::i18n_get_buf_internal(locale, key, &result[0], result.size() + 1);
+  return result;
+#endif
+}
+
+const char *I18nComponent::view_(Locale locale, Key key, size_t *len) {
+  if (const char *text = this->override_(locale, key, len))
+    return text;
+#if I18N_COMPRESSED
+  return this->cached_(locale, key, len);
+#else
+  return esphome::i18n::i18n_get_view_internal(locale, key, len);
+#endif
+}
+
+const char *I18nComponent::view_(Locale locale, const char *key, size_t *len) {
+#if I18N_COMPRESSED
+  if (key == nullptr)
+    key = "";
+  int idx = esphome::i18n::i18n_key_index_internal(key);
+  if (idx < 0) {
+    // Key not found - return key itself as fallback
+    this->count_miss_();
+    if (len)
+      *len = strlen(key);
+    return key;
+  }
+  this->note_recent_(static_cast<Key>(idx));
+  return this->view_(locale, static_cast<Key>(idx), len);
+#else
+  if ((this->prefetch_chunk_ != 0 || this->has_overrides_()) && key != nullptr) {
+    // The warm-up and the overrides need the key ID, resolve it here instead of in the lookup
+    int idx = esphome::i18n::i18n_key_index_internal(key);
+    if (idx >= 0) {
+      this->note_recent_(static_cast<Key>(idx));
+      return this->view_(locale, static_cast<Key>(idx), len);
+    }
+  }
+  return esphome::i18n::i18n_get_view_internal(locale, key, len);
+#endif
+}
+
+#if I18N_COMPRESSED
+const char *I18nComponent::cached_(Locale locale, Key key, size_t *len) {
+  LockGuard guard(this->cache_lock_);
+  return this->cached_locked_(locale, key, len);
+}
+
+const char *I18nComponent::cached_locked_(Locale locale, Key key, size_t *len) {
+  static constexpr size_t SLOT_SIZE = esphome::i18n::I18N_MAX_LEN + 1;
+  // Lookups before setup() decode without the cache
+  if (this->cache_.empty())
+    return esphome::i18n::i18n_get_view_internal(locale, key, len);
+
+  // Few entries, a linear scan is cheaper than any index
+  size_t victim = 0;
+  for (size_t i = 0; i < this->cache_.size(); ++i) {
+    CacheEntry &entry = this->cache_[i];
+    if (entry.stamp != 0 && entry.key == static_cast<uint16_t>(key) && entry.locale == static_cast<uint8_t>(locale)) {
+      entry.stamp = ++this->cache_clock_;
+      this->cache_hits_++;
+#if I18N_STATISTICS
+      // Misses are counted by the decoder, hits never reach it
+      esphome::i18n::i18n_count_lookup_internal(key, 0);
+#endif
+      if (len)
+        *len = entry.len;
+      return &this->cache_text_[i * SLOT_SIZE];
+    }
+    if (entry.stamp < this->cache_[victim].stamp)
+      victim = i;
+  }
+
+  // Miss - decode into the least recently used slot
+  this->cache_misses_++;
+  char *text = &this->cache_text_[victim * SLOT_SIZE];
+  size_t full = esphome::i18n::i18n_get_buf_internal(locale, key, text, SLOT_SIZE);
+  this->cache_[victim] = CacheEntry{++this->cache_clock_, static_cast<uint32_t>(full), static_cast<uint16_t>(key),
+                                    static_cast<uint8_t>(locale)};
+  if (len)
+    *len = full;
+  return text;
+}
+#endif
+
+std::string_view I18nComponent::translate_view(const char *key) {
+  size_t len = 0;
+  const char *p = this->view_(this->locale_(), key, &len);
+  return std::string_view(p, len);
+}
+
+std::string_view I18nComponent::translate_view(Key key) {
+  this->note_recent_(key);
+  size_t len = 0;
+  const char *p = this->view_(this->locale_(), key, &len);
+  return std::string_view(p, len);
+}
+
+size_t I18nComponent::translate_many(const Key *keys, const char **out, size_t n) {
+  if (keys == nullptr || out == nullptr)
+    return 0;
+  Locale locale = this->locale_();
+  size_t done = 0;
+#if I18N_ZERO_COPY
+  // One table resolution, then one indexed load per key
+  done = esphome::i18n::i18n_get_views_internal(locale, keys, out, n);
+#endif
+  if (done < n)
+    this->copy_many_(locale, keys + done, out + done, n - done);
+  if (this->has_overrides_()) {
+    for (size_t i = 0; i < n; ++i) {
+      if (const char *text = this->override_(locale, keys[i], nullptr))
+        out[i] = text;
+    }
+  }
+  return n;
+}
+
+void I18nComponent::copy_many_(Locale locale, const Key *keys, const char **out, size_t n) {
+  // One buffer for all of them, sized from the length table first
+  size_t total = 0;
+  for (size_t i = 0; i < n; ++i)
+    total += esphome::i18n::i18n_get_buf_internal(locale, keys[i], nullptr, 0) + 1;
+  this->batch_text_.resize(total);
+  char *text = this->batch_text_.data();
+  for (size_t i = 0; i < n; ++i) {
+    size_t room = this->batch_text_.data() + total - text;
+    size_t len = esphome::i18n::i18n_get_buf_internal(locale, keys[i], text, room);
+    out[i] = text;
+    text += std::min(len, room - 1) + 1;
+  }
+}
+
+const char *I18nComponent::translate_options(Key key) {
+  // Pre-joined at build time, so this is a plain table lookup
+  this->note_recent_(key);
+  return this->view_(this->locale_(), key, nullptr);
+}
+
+const char *I18nComponent::translate_options(const char *key) { return this->view_(this->locale_(), key, nullptr); }
+
+LocaleHandle I18nComponent::locale(const std::string &locale) { return this->locale(resolve_locale_(locale)); }
+
+LocaleHandle I18nComponent::locale(Locale locale) {
+#if I18N_EXTERNAL_STORAGE
+  // Views through the handle then point into the mapping, like those of the current locale
+  if (!esphome::i18n::i18n_map_locale_internal(locale))
+    ESP_LOGW(TAG, "Locale id=%u could not be mapped, its views are copied", (unsigned) locale);
+#endif
+  return LocaleHandle(this, locale);
+}
+
+std::string_view I18nComponent::translate_view(Key key, const std::string &locale) {
+  this->note_recent_(key);
+  size_t len = 0;
+  const char *p = this->view_(resolve_locale_(locale), key, &len);
+  return std::string_view(p, len);
+}
+
+std::string_view I18nComponent::translate_view(Key key, Locale locale) {
+  this->note_recent_(key);
+  size_t len = 0;
+  const char *p = this->view_(locale, key, &len);
+  return std::string_view(p, len);
+}
+
+void I18nComponent::bind(lv_obj_t *label, Key key) {
+  if (label == nullptr)
+    return;
+
+  // Rebinding an already bound label just changes its key
+  for (auto &binding : this->bindings_) {
+    if (binding.obj == label) {
+      if (binding.stale)
+        this->stale_count_--;
+      binding.key = static_cast<uint16_t>(key);
+      binding.stale = false;
+      this->apply_binding_(binding);
+      return;
+    }
+  }
+
+  this->bindings_.push_back(LabelBinding{label, static_cast<uint16_t>(key), false});
+  this->apply_binding_(this->bindings_.back());
+}
+
+void I18nComponent::bind(lv_obj_t **label_ref, Key key) {
+  if (label_ref == nullptr)
+    return;
+  this->pending_bindings_.push_back(PendingBinding{label_ref, static_cast<uint16_t>(key)});
+}
+
+void I18nComponent::unbind(lv_obj_t *label) {
+  for (auto it = this->bindings_.begin(); it != this->bindings_.end(); ++it) {
+    if (it->obj == label) {
+      if (it->stale)
+        this->stale_count_--;
+      this->bindings_.erase(it);
+      return;
+    }
+  }
+}
+
+void I18nComponent::apply_binding_(const LabelBinding &binding) {
+  Key key = static_cast<Key>(binding.key);
+#if I18N_ZERO_COPY && !I18N_EXTERNAL_STORAGE
+  if (const char *text = this->override_(this->locale_(), key, nullptr)) {
+    // Overrides move when others change, LVGL keeps a copy
+    lv_label_set_text(binding.obj, text);
+    return;
+  }
+  // Flash strings live forever, so LVGL can reference them without a copy
+  const char *text = esphome::i18n::i18n_get_view_internal(this->locale_(), key, nullptr);
+  lv_label_set_text_static(binding.obj, text);
+#elif I18N_COMPRESSED
+  if (const char *text = this->override_(this->locale_(), key, nullptr)) {
+    lv_label_set_text(binding.obj, text);
+    return;
+  }
+  // Hold the cache while LVGL copies, a lookup from another task could reuse the slot
+  LockGuard guard(this->cache_lock_);
+  lv_label_set_text(binding.obj, this->cached_locked_(this->locale_(), key, nullptr));
+#else
+  // Shared buffers and partition mappings get reused, so LVGL keeps its own copy
+  lv_label_set_text(binding.obj, this->view_(this->locale_(), key, nullptr));
+#endif
+}
+
+void I18nComponent::refresh_bindings_() {
+  if (this->bindings_.empty())
+    return;
+
+  // Only touch labels that are visible now, the rest is refreshed in loop()
+  lv_obj_t *active = lv_scr_act();
+  for (auto &binding : this->bindings_) {
+    if (is_visible_(binding.obj, active)) {
+      this->apply_binding_(binding);
+      if (binding.stale) {
+        binding.stale = false;
+        this->stale_count_--;
+      }
+    } else if (!binding.stale) {
+      binding.stale = true;
+      this->stale_count_++;
+    }
+  }
+  this->last_screen_ = active;
+
+  ESP_LOGD(TAG, "Refreshed bound labels, %zu waiting for their screen", this->stale_count_);
 }
 
 }  // namespace i18n
@@ -2,14 +2,20 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/automation.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/preferences.h"
 #include "esphome/components/lvgl/lvgl_esphome.h"
 #include "generated/translations.h"
+#include <string_view>
+#include <vector>
 
 #ifdef USE_I18N
 
 namespace esphome {
 namespace i18n {
 
+class LocaleHandle;
+
 /**
  * @brief I18N Component for ESPHome
  * 
@@ -23,22 +29,61 @@ class I18nComponent : public Component {
    */
   void setup() override;
 
+  /**
+   * @brief Main loop - refreshes bound labels when their screen becomes active
+   */
+  void loop() override;
+
   /**
    * @brief Dump configuration to logs
    */
   void dump_config() override;
 
+  /**
+   * @brief Shutdown - writes overrides still waiting for their delayed save
+   */
+  void on_shutdown() override;
+
+  /**
+   * @brief Set the number of decoded strings kept when translations are compressed
+   * @param size Cache entries, each holding up to I18N_MAX_LEN bytes
+   */
+  void set_cache_size(size_t size) { this->cache_size_ = size; }
+
+  /**
+   * @brief Warm up the strings of bound and recently viewed keys after a locale change
+   * @param keys Keys touched per loop iteration, 0 disables the warm-up
+   */
+  void set_prefetch(size_t keys) { this->prefetch_chunk_ = keys; }
+
   /**
    * @brief Set current locale
+   *
+   * esphome::i18n::set_locale() from lambdas ends up here as well, so bound
+   * labels and listeners follow every switch.
+   *
    * @param locale Locale code (e.g., "en", "ru", "de")
    */
-  void set_current_locale(const std::string &locale);
+  void set_current_locale(const char *locale);
+  void set_current_locale(const std::string &locale) { this->set_current_locale(locale.c_str()); }
 
   /**
-   * @brief Get current locale
+   * @brief Get current locale code, without allocating
+   * @return Current locale code, points into flash
+   */
+  const char *locale_code() const { return I18N_LOCALE_CODES[this->locale_index()]; }
+
+  /**
+   * @brief Get current locale index
+   * @return Current locale as index into the generated Locale enum
+   */
+  uint8_t locale_index() const { return static_cast<uint8_t>(this->locale_()); }
+
+  /**
+   * @brief Get current locale as a string copy, prefer locale_code()
    * @return Current locale code
    */
-  std::string get_current_locale();
+  std::string get_current_locale() const { return std::string(this->locale_code()); }
 
   /**
    * @brief Translate a key using CURRENT locale
@@ -55,8 +100,488 @@ class I18nComponent : public Component {
    */
   std::string translate(const std::string &key, const std::string &locale);
 
+  /**
+   * @brief Translate a compile-time key ID using CURRENT locale
+   * @param key Key ID (e.g., Key::WEATHER_CLOUDY)
+   * @return Translated string
+   */
+  std::string translate(Key key);
+
+  /**
+   * @brief Translate a compile-time key ID using SPECIFIC locale
+   * @param key Key ID
+   * @param locale Specific locale to use
+   * @return Translated string
+   */
+  std::string translate(Key key, const std::string &locale);
+
+  /**
+   * @brief Translate a compile-time key ID using SPECIFIC locale index
+   * @param key Key ID
+   * @param locale Locale ID (e.g., Locale::RU)
+   * @return Translated string
+   */
+  std::string translate(Key key, Locale locale);
+
+  /**
+   * @brief Translate the plural form of a key for a count using CURRENT locale
+   *
+   * The form (`one`, `few`, `many`, ...) is picked by the CLDR rule of the
+   * locale, compiled into the firmware. Keys without plural forms translate as usual.
+   * Use esphome::i18n::plural() to pick the form for translate_view() or format().
+   *
+   * @param key Key ID of a plural entry (e.g., Key::DEVICES)
+   * @param n Count
+   * @return Translated string
+   */
+  std::string translate_plural(Key key, int32_t n);
+
+  /**
+   * @brief Translate without copying, using CURRENT locale
+   *
+   * The view points straight into flash. On ESP8266 it points into a shared
+   * buffer that the next view lookup overwrites, so copy it if you keep it.
+   * With `compression:` it points into the decoded-string cache and stays valid
+   * until `cache_size` other strings were decoded, by any task, so it is not safe
+   * while other tasks translate. With `storage: partition` it
+   * points into the partition, which stays mapped once a locale was selected or
+   * a handle for it was made; for other locales it points into a buffer of the
+   * calling task that its next view lookup overwrites.
+   * If the key is not found the view refers to @p key itself.
+   * Views are meant for the main loop; from other tasks use translate() or
+   * esphome::i18n::tr(key, buf, n).
+   *
+   * @param key Translation key (e.g., "weather.cloudy")
+   * @return View of the translated string
+   */
+  std::string_view translate_view(const char *key);
+
+  /**
+   * @brief Translate a compile-time key ID without copying, using CURRENT locale
+   * @param key Key ID (e.g., Key::WEATHER_CLOUDY)
+   * @return View of the translated string
+   */
+  std::string_view translate_view(Key key);
+
+  /**
+   * @brief Translate a compile-time key ID without copying, using SPECIFIC locale
+   * @param key Key ID
+   * @param locale Specific locale to use
+   * @return View of the translated string
+   */
+  std::string_view translate_view(Key key, const std::string &locale);
+
+  /**
+   * @brief Translate a compile-time key ID without copying, using SPECIFIC locale index
+   * @param key Key ID
+   * @param locale Locale ID (e.g., Locale::RU)
+   * @return View of the translated string
+   */
+  std::string_view translate_view(Key key, Locale locale);
+
+  /**
+   * @brief Translation as pointer and length, usable from any task
+   *
+   * Points straight into flash where it can; otherwise, and for overrides, the
+   * text is copied into @p buf. Used by the web_server catalog. Where strings
+   * are read in place @p buf may be null, an override then returns null.
+   *
+   * @param locale Locale ID
+   * @param key Key ID
+   * @param buf Buffer of @p n > 0 bytes, I18N_MAX_LEN + 1 never truncates
+   * @param n Size of @p buf
+   * @param len Receives the length of the returned text
+   * @return NUL-terminated text, in flash or in @p buf
+   */
+  const char *translate_into(Locale locale, Key key, char *buf, size_t n, size_t *len);
+
+  /**
+   * @brief Version of the texts of a locale, changes with the translations and overrides
+   * @param locale Locale ID
+   * @return Hash from the generator, combined with the overrides
+   */
+  uint32_t catalog_version(Locale locale);
+
+  /**
+   * @brief Get a handle for rendering in a locale other than the current one
+   *
+   * The code is resolved once, lookups through the handle only index the
+   * tables of its locale. Unknown codes give a handle for the default locale.
+   * With `storage: partition` the locale is mapped here and stays mapped, so
+   * make handles from the main loop.
+   *
+   * @code
+   * auto ru = id(i18n_comp).locale("ru");
+   * lv_label_set_text(id(title_ru), ru.tr(Key::TITLE));
+   * @endcode
+   *
+   * @param locale Locale code
+   * @return Handle for @p locale
+   */
+  LocaleHandle locale(const std::string &locale);
+
+  /**
+   * @brief Get a handle for a locale ID
+   * @param locale Locale ID (e.g., Locale::RU)
+   * @return Handle for @p locale
+   */
+  LocaleHandle locale(Locale locale);
+
+  /**
+   * @brief Translate many compile-time key IDs at once, using CURRENT locale
+   *
+   * Meant for page setup that fills dozens of widgets: the locale is read and
+   * its table resolved once, then every key is one indexed load, without
+   * std::string allocations. The pointers go straight into flash, or into the
+   * partition with `storage: partition`. On ESP8266, with `compression:` or for
+   * a locale never selected the strings are copied back to back into one
+   * buffer owned by the component, valid until the next translate_many().
+   *
+   * @code
+   * static const Key KEYS[] = {Key::MENU_WIFI, Key::MENU_DISPLAY, Key::MENU_ABOUT};
+   * const char *text[3];
+   * id(i18n_comp).translate_many(KEYS, text);
+   * for (size_t i = 0; i < 3; ++i) lv_label_set_text(id(menu_labels)[i], text[i]);
+   * @endcode
+   *
+   * @param keys Key IDs to translate
+   * @param out Receives one NUL-terminated string per key
+   * @param n Number of keys
+   * @return Number of strings written to @p out
+   */
+  size_t translate_many(const Key *keys, const char **out, size_t n);
+
+  /**
+   * @brief Translate an array of key IDs into an array of the same size
+   */
+  template<size_t N> size_t translate_many(const Key (&keys)[N], const char *(&out)[N]) {
+    return this->translate_many(keys, out, N);
+  }
+
+  /**
+   * @brief Get LVGL roller/dropdown options for a list entry, using CURRENT locale
+   *
+   * List entries (`sleep_time: [Never, 1 minute]`) are joined with '\n' at
+   * build time, so the result can be passed to lv_roller_set_options() as is.
+   * The same lifetime rules as translate_view() apply.
+   *
+   * @param key Key ID of a list entry
+   * @return Newline-separated options
+   */
+  const char *translate_options(Key key);
+
+  /**
+   * @brief Get LVGL roller/dropdown options for a list entry by string key
+   * @param key Translation key of a list entry
+   * @return Newline-separated options
+   */
+  const char *translate_options(const char *key);
+
+  /**
+   * @brief Fill the placeholders of a translation using CURRENT locale
+   *
+   * A translation like `ota.progress: "Updating {percent}%"` is split into
+   * literal runs and argument slots at build time, so nothing is parsed here.
+   * Arguments go in the order the placeholders first appear in the default
+   * locale; integers, floats (`{value:.1}` for one decimal) and strings are
+   * accepted. Translations without placeholders are copied as they are.
+   *
+   * @param buf Output buffer, always NUL-terminated if @p n > 0
+   * @param n Size of @p buf
+   * @param key Key ID (e.g., Key::OTA_PROGRESS)
+   * @param args Values for the placeholders
+   * @return Full length of the text like snprintf, the output is truncated if it is >= @p n
+   */
+  template<typename... Args> size_t format(char *buf, size_t n, Key key, const Args &...args) {
+    return esphome::i18n::format(buf, n, this->locale_(), key, args...);
+  }
+
+#ifdef USE_I18N_OVERRIDES
+  /**
+   * @brief Replace the translation of a key in one locale at runtime (`overrides:`)
+   *
+   * Overrides live in a fixed arena of `arena_size` bytes and are checked
+   * before the flash tables by translate(), views, translate_many() and bound
+   * labels; format() templates and the free tr() functions are not affected.
+   * With `restore: true` they are saved to preferences and survive reboots of
+   * the same firmware. Views of an override stay valid until overrides change.
+   *
+   * @param key Translation key
+   * @param text New text
+   * @param locale Locale code, the current locale if empty
+   * @return false if the key or locale is unknown or the arena is full
+   */
+  bool set_override(const std::string &key, const std::string &text, const std::string &locale);
+
+  /**
+   * @brief Replace the translation of a key ID in one locale at runtime
+   * @param key Key ID
+   * @param locale Locale ID
+   * @param text New text, @p len bytes
+   * @param len Length of @p text
+   * @return false if the key or locale is out of range or the arena is full
+   */
+  bool set_override(Key key, Locale locale, const char *text, size_t len);
+
+  /**
+   * @brief Go back to the compiled-in translation of a key
+   * @param key Translation key
+   * @param locale Locale code, the current locale if empty
+   */
+  void clear_override(const std::string &key, const std::string &locale);
+
+  /**
+   * @brief Remove all overrides
+   */
+  void clear_overrides();
+
+  /**
+   * @brief Restore overrides from preferences on boot and save every change
+   */
+  void set_restore_overrides(bool restore) { this->restore_overrides_ = restore; }
+#endif
+
+#if I18N_STATISTICS
+  /**
+   * @brief Number of keys not looked up since boot (`statistics: true`)
+   *
+   * Keys used only at startup count as used. The counters themselves are
+   * esphome::i18n::i18n_stats.
+   */
+  static size_t unused_key_count();
+#endif
+
+  /**
+   * @brief Bind an LVGL label to a translation key
+   *
+   * The label text is set immediately and re-set on every locale change.
+   * Labels on inactive screens are refreshed when their screen is loaded.
+   * The label must outlive the binding (or be unbound before deletion).
+   *
+   * @param label LVGL label object
+   * @param key Key ID to display
+   */
+  void bind(lv_obj_t *label, Key key);
+
+  /**
+   * @brief Bind a label that is created later (used by the YAML `bindings:` option)
+   * @param label_ref Address of the label pointer, resolved on the first loop()
+   * @param key Key ID to display
+   */
+  void bind(lv_obj_t **label_ref, Key key);
+
+  /**
+   * @brief Remove the binding of an LVGL label
+   * @param label LVGL label object
+   */
+  void unbind(lv_obj_t *label);
+
+  /**
+   * @brief Register a callback called after every locale change
+   * @param callback Called with the new locale code
+   */
+  void add_on_locale_change_callback(std::function<void(const std::string &)> &&callback) {
+    this->locale_change_callback_.add(std::move(callback));
+  }
+
  protected:
-  std::string current_locale_;  ///< Currently active locale
+  /// Label bound to a key, kept compact since there can be hundreds of them
+  struct LabelBinding {
+    lv_obj_t *obj;
+    uint16_t key;
+    bool stale;  ///< Locale changed while the label's screen was inactive
+  };
+
+  /// Binding whose label pointer is not assigned yet
+  struct PendingBinding {
+    lv_obj_t **ref;
+    uint16_t key;
+  };
+
+#ifdef USE_I18N_OVERRIDES
+  /// Override in the arena, followed by its text and a NUL, padded to an even size.
+  /// Records are sorted by key and locale, so a lookup stops at the first larger one.
+  struct OverrideRecord {
+    uint16_t key;
+    uint16_t locale;
+    uint16_t len;
+  };
+  // Records are ordered and looked up by key << 8 | locale
+  static_assert(esphome::i18n::I18N_LOCALE_COUNT <= 256, "override ids hold the locale in 8 bits");
+
+  /// Arena as stored in preferences
+  struct OverrideStore {
+    uint32_t layout;  ///< I18N_LAYOUT_HASH of the firmware that wrote it
+    uint16_t used;    ///< Bytes of arena holding records
+    alignas(OverrideRecord) uint8_t arena[I18N_OVERRIDE_ARENA_SIZE];
+  };
+
+  static size_t override_size_(size_t len) { return (sizeof(OverrideRecord) + len + 2) & ~size_t(1); }
+
+  /// Walk the sorted records, nullptr if the key has no override in this locale
+  const char *find_override_(Locale locale, Key key, size_t *len) const;
+
+  /// Update the labels and schedule the save to preferences after overrides changed
+  void overrides_changed_(Locale locale);
+  /// Write the arena to preferences if it changed since the last save
+  void save_overrides_();
+
+  /// Delay after the last change before the overrides are written to flash
+  static constexpr uint32_t OVERRIDE_SAVE_DELAY_MS = 5000;
+#endif
+
+  /// Whether any override is set, the one branch lookups pay when there are none
+  bool has_overrides_() const {
+#ifdef USE_I18N_OVERRIDES
+    return this->overrides_.used != 0;
+#else
+    return false;
+#endif
+  }
+
+  /// Override of a key, nullptr when it has none
+  const char *override_(Locale locale, Key key, size_t *len) const {
+#ifdef USE_I18N_OVERRIDES
+    if (this->overrides_.used != 0)
+      return this->find_override_(locale, key, len);
+#else
+    (void) locale;
+    (void) key;
+    (void) len;
+#endif
+    return nullptr;
+  }
+
+  /// Decoded string kept in the cache, its text lives in cache_text_
+  struct CacheEntry {
+    uint32_t stamp;  ///< Last use, 0 for an empty slot
+    uint32_t len;    ///< Decoded length in bytes
+    uint16_t key;
+    uint8_t locale;
+  };
+
+  /// Copy translation for a key ID into a string sized from the length table
+  std::string translate_(Locale locale, Key key);
+
+  /// Translation as a NUL-terminated pointer, from flash or from the decoded-string cache
+  const char *view_(Locale locale, Key key, size_t *len);
+  const char *view_(Locale locale, const char *key, size_t *len);
+
+  /// Copy strings of translate_many() that cannot point into flash back to back into batch_text_
+  void copy_many_(Locale locale, const Key *keys, const char **out, size_t n);
+
+#if I18N_COMPRESSED
+  /// Look up a decoded string, decoding it into the least recently used slot on a miss
+  const char *cached_(Locale locale, Key key, size_t *len);
+  /// cached_() for callers that already hold cache_lock_ and read the text before releasing it
+  const char *cached_locked_(Locale locale, Key key, size_t *len);
+#endif
+
+  /// Remember a key viewed from the main loop, it is warmed up first after a locale change
+  void note_recent_(Key key) {
+    if (this->prefetch_chunk_ == 0)
+      return;
+    uint16_t entry = static_cast<uint16_t>(key) + 1;
+    for (uint16_t recent : this->recent_) {
+      if (recent == entry)
+        return;
+    }
+    this->recent_[this->recent_pos_] = entry;
+    this->recent_pos_ = (this->recent_pos_ + 1) % PREFETCH_RECENT;
+  }
+
+  /// Queue the keys to warm up for the new locale
+  void start_prefetch_();
+
+  /// Touch the strings of the next prefetch_chunk_ queued keys
+  void prefetch_step_();
+
+  /// Resolve a locale code to its index, unknown codes map to the default locale
+  static Locale resolve_locale_(const std::string &locale);
+
+  /// Current locale, read from the one atomic index in the generated tables
+  Locale locale_() const { return esphome::i18n::i18n_get_locale_index_internal(); }
+
+  /// Count a string key that was not found, when statistics are enabled
+  void count_miss_() {
+#if I18N_STATISTICS
+    esphome::i18n::i18n_count_miss_internal();
+#endif
+  }
+
+#if I18N_STATISTICS
+  /// Log lookup totals, the hottest and the unused keys
+  void dump_statistics_();
+#endif
+
+  /// Set the label text of a binding for the current locale
+  void apply_binding_(const LabelBinding &binding);
+
+  /// Re-set bound labels on the active screen, mark the others stale
+  void refresh_bindings_();
+
+  /// Whether a label shows now: on the active screen, or on the top or system layer drawn over every screen
+  static bool is_visible_(lv_obj_t *obj, lv_obj_t *active) {
+    lv_obj_t *screen = lv_obj_get_screen(obj);
+    return screen == active || screen == lv_layer_top() || screen == lv_layer_sys();
+  }
+
+  std::vector<LabelBinding> bindings_;          ///< Bound labels
+  std::vector<PendingBinding> pending_bindings_;  ///< Bindings resolved on first loop()
+  size_t stale_count_{0};                       ///< Bindings waiting for their screen
+  lv_obj_t *last_screen_{nullptr};              ///< Active screen at the last refresh
+
+  static constexpr size_t PREFETCH_RECENT = 16;       ///< Recently viewed keys remembered for the warm-up
+  size_t prefetch_chunk_{0};                          ///< Keys warmed up per loop(), 0 when disabled
+  std::vector<uint16_t> prefetch_queue_;              ///< Keys left to warm up for the current locale
+  size_t prefetch_pos_{0};                            ///< Next key in prefetch_queue_
+  uint16_t recent_[PREFETCH_RECENT]{};                ///< Ring of recently viewed keys + 1, 0 when empty
+  uint8_t recent_pos_{0};                             ///< Next slot of recent_
+
+  CallbackManager<void(const std::string &)> locale_change_callback_;  ///< Locale change listeners
+
+  std::vector<char> batch_text_;  ///< Strings of the last translate_many() when they cannot point into flash
+
+#ifdef USE_I18N_OVERRIDES
+  OverrideStore overrides_{};       ///< Fixed arena of runtime overrides, no heap
+  Mutex override_lock_;             ///< Held while overrides change and by translate() reading them
+  ESPPreferenceObject override_pref_;
+  bool restore_overrides_{true};
+  bool overrides_dirty_{false};  ///< Changed since the last save to preferences
+#endif
+
+  size_t cache_size_{8};  ///< Decoded-string cache entries
+#if I18N_COMPRESSED
+  Mutex cache_lock_;               ///< Guards the cache, held by copies out of it
+  std::vector<CacheEntry> cache_;  ///< Decoded-string cache, allocated in setup()
+  std::vector<char> cache_text_;   ///< cache_size_ slots of I18N_MAX_LEN + 1 bytes
+  uint32_t cache_clock_{0};        ///< Stamp of the latest lookup
+  uint32_t cache_hits_{0};
+  uint32_t cache_misses_{0};
+#endif
+};
+
+/**
+ * @brief Trigger fired after the locale changed
+ *
+ * Usage in YAML:
+ * @code
+ * i18n:
+ *   on_locale_change:
+ *     - logger.log:
+ *         format: "Locale is now %s"
+ *         args: [x.c_str()]
+ * @endcode
+ */
+class LocaleChangeTrigger : public Trigger<std::string> {
+ public:
+  /**
+   * @brief Constructor
+   * @param parent Pointer to I18nComponent instance
+   */
+  explicit LocaleChangeTrigger(I18nComponent *parent) {
+    parent->add_on_locale_change_callback([this](const std::string &locale) { this->trigger(locale); });
+  }
 };
 
 /**
@@ -99,6 +624,95 @@ template<typename... Ts> class SetLocaleAction : public Action<Ts...> {
   TemplatableValue<std::string, Ts...> locale_;      ///< Locale template
 };
 
+/**
+ * @brief One locale of the component, for showing several languages side by side
+ *
+ * A handle is two words and meant to be kept, e.g. in a static of a lambda.
+ * Its strings follow the lifetime rules of I18nComponent::translate_view():
+ * from flash or the partition they live forever, from the decoded-string
+ * cache or a shared buffer (compression, ESP8266, a partition locale that
+ * could not be mapped) copy them before the next lookup.
+ */
+class LocaleHandle {
+ public:
+  LocaleHandle(I18nComponent *parent, Locale locale) : parent_(parent), locale_(locale) {}
+
+  /// Locale ID of the handle
+  Locale index() const { return this->locale_; }
+
+  /// Locale code of the handle, points into flash
+  const char *code() const { return I18N_LOCALE_CODES[static_cast<size_t>(this->locale_)]; }
+
+  /// Translation as a NUL-terminated string
+  const char *tr(Key key) const { return this->view(key).data(); }
+
+  /// Translation as a view
+  std::string_view view(Key key) const { return this->parent_->translate_view(key, this->locale_); }
+
+  /// Translation as a copy, safe from other tasks
+  std::string translate(Key key) const { return this->parent_->translate(key, this->locale_); }
+
+  /// Fill the placeholders of a translation, see I18nComponent::format()
+  template<typename... Args> size_t format(char *buf, size_t n, Key key, const Args &...args) const {
+    return esphome::i18n::format(buf, n, this->locale_, key, args...);
+  }
+
+ protected:
+  I18nComponent *parent_;
+  Locale locale_;
+};
+
+#ifdef USE_I18N_OVERRIDES
+/**
+ * @brief Action for patching a translation at runtime, e.g. from an API service
+ *
+ * Usage in YAML:
+ * @code
+ * api:
+ *   services:
+ *     - service: set_label
+ *       variables:
+ *         key: string
+ *         text: string
+ *       then:
+ *         - i18n.set_override:
+ *             key: !lambda return key;
+ *             text: !lambda return text;
+ * @endcode
+ */
+template<typename... Ts> class SetOverrideAction : public Action<Ts...> {
+ public:
+  explicit SetOverrideAction(I18nComponent *parent) : parent_(parent) {}
+
+  void set_key(TemplatableValue<std::string, Ts...> key) { this->key_ = key; }
+  void set_text(TemplatableValue<std::string, Ts...> text) { this->text_ = text; }
+  void set_locale(TemplatableValue<std::string, Ts...> locale) { this->locale_ = locale; }
+
+  void play(Ts... x) override {
+    this->parent_->set_override(this->key_.value(x...), this->text_.value(x...), this->locale_.value(x...));
+  }
+
+ protected:
+  I18nComponent *parent_;
+  TemplatableValue<std::string, Ts...> key_;
+  TemplatableValue<std::string, Ts...> text_;
+  TemplatableValue<std::string, Ts...> locale_;
+};
+
+/**
+ * @brief Action removing all runtime overrides
+ */
+template<typename... Ts> class ClearOverridesAction : public Action<Ts...> {
+ public:
+  explicit ClearOverridesAction(I18nComponent *parent) : parent_(parent) {}
+
+  void play(Ts... /*x*/) override { this->parent_->clear_overrides(); }
+
+ protected:
+  I18nComponent *parent_;
+};
+#endif
+
 /**
  * @brief Global component pointer for easy access from lambdas
  * 
@@ -0,0 +1,163 @@
+#include "i18n_catalog.h"
+
+#if defined(USE_I18N) && defined(USE_I18N_CATALOG)
+
+#include "esphome/core/log.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+namespace esphome {
+namespace i18n {
+
+static const char *const TAG = "i18n.catalog";
+
+// Writes text as a JSON string, runs without escapes go out in one piece
+static void print_json_string(AsyncResponseStream *stream, const char *text, size_t len) {
+  stream->print("\"");
+  size_t run = 0;
+  for (size_t i = 0; i < len; ++i) {
+    uint8_t c = static_cast<uint8_t>(text[i]);
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    if (i > run)
+      stream->printf("%.*s", static_cast<int>(i - run), text + run);
+    if (c == '"') {
+      stream->print("\\\"");
+    } else if (c == '\\') {
+      stream->print("\\\\");
+    } else if (c == '\n') {
+      stream->print("\\n");
+    } else {
+      stream->printf("\\u%04x", c);
+    }
+    run = i + 1;
+  }
+  if (len > run)
+    stream->printf("%.*s", static_cast<int>(len - run), text + run);
+  stream->print("\"");
+}
+
+// Clients send back the ETag of their copy, an unchanged catalog is answered with 304
+static bool etag_matches(AsyncWebServerRequest *request, const char *etag) {
+#ifdef USE_ESP32
+  auto header = request->get_header("If-None-Match");
+  return header.has_value() && *header == etag;
+#else
+  return request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == etag;
+#endif
+}
+
+void I18nCatalogHandler::setup() {
+  this->base_->init();
+  this->base_->add_handler(this);
+}
+
+void I18nCatalogHandler::dump_config() {
+  ESP_LOGCONFIG(TAG, "I18N Catalog");
+  ESP_LOGCONFIG(TAG, "  Endpoints: /i18n, /i18n/catalog, /i18n/locale");
+  ESP_LOGCONFIG(TAG, "  Page size: %zu", this->page_size_);
+}
+
+bool I18nCatalogHandler::canHandle(AsyncWebServerRequest *request) const {
+  if (request->method() == HTTP_GET)
+    return request->url() == "/i18n" || request->url() == "/i18n/catalog";
+  if (request->method() == HTTP_POST)
+    return request->url() == "/i18n/locale";
+  return false;
+}
+
+void I18nCatalogHandler::handleRequest(AsyncWebServerRequest *request) {
+  if (request->url() == "/i18n/catalog") {
+    this->handle_catalog_(request);
+  } else if (request->url() == "/i18n/locale") {
+    this->handle_locale_(request);
+  } else {
+    this->handle_index_(request);
+  }
+}
+
+void I18nCatalogHandler::handle_index_(AsyncWebServerRequest *request) {
+  AsyncResponseStream *stream = request->beginResponseStream("application/json");
+  stream->printf("{\"locale\":\"%s\",\"keys\":%u,\"locales\":[", this->parent_->locale_code(),
+                 static_cast<unsigned>(I18N_KEY_COUNT));
+  for (size_t i = 0; i < I18N_LOCALE_COUNT; ++i) {
+    stream->printf("%s{\"code\":\"%s\",\"version\":\"%08x\"}", i ? "," : "", I18N_LOCALE_CODES[i],
+                   static_cast<unsigned>(this->parent_->catalog_version(static_cast<Locale>(i))));
+  }
+  stream->print("]}");
+  request->send(stream);
+}
+
+void I18nCatalogHandler::handle_catalog_(AsyncWebServerRequest *request) {
+  std::string code = request->arg("locale").c_str();
+  int loc = code.empty() ? this->parent_->locale_index() : i18n_locale_index_internal(code.c_str());
+  if (loc < 0) {
+    request->send(404, "text/plain", "Unknown locale");
+    return;
+  }
+  Locale locale = static_cast<Locale>(loc);
+
+  char etag[12];
+  snprintf(etag, sizeof(etag), "\"%08x\"", static_cast<unsigned>(this->parent_->catalog_version(locale)));
+  if (etag_matches(request, etag)) {
+    request->send(304);
+    return;
+  }
+
+  size_t first = strtoul(request->arg("offset").c_str(), nullptr, 10);
+  if (first > I18N_KEY_COUNT)
+    first = I18N_KEY_COUNT;
+  size_t last = std::min(first + this->page_size_, I18N_KEY_COUNT);
+
+  AsyncResponseStream *stream = request->beginResponseStream("application/json");
+  stream->addHeader("ETag", etag);
+  stream->addHeader("Cache-Control", "no-cache");
+  stream->printf("{\"locale\":\"%s\",\"version\":%s,\"total\":%u,\"offset\":%u,\"next\":", I18N_LOCALE_CODES[loc],
+                 etag, static_cast<unsigned>(I18N_KEY_COUNT), static_cast<unsigned>(first));
+  if (last < I18N_KEY_COUNT) {
+    stream->printf("%u", static_cast<unsigned>(last));
+  } else {
+    stream->print("null");
+  }
+  stream->print(",\"strings\":{");
+  // Where the strings are read in place only an override needs the buffer, it is allocated for the first one
+  std::unique_ptr<char[]> buf;
+#if !I18N_ZERO_COPY || I18N_EXTERNAL_STORAGE
+  buf.reset(new char[I18N_MAX_LEN + 1]);
+#endif
+  for (size_t i = first; i < last; ++i) {
+    Key key = static_cast<Key>(i);
+    size_t len = 0;
+    const char *text = this->parent_->translate_into(locale, key, buf.get(), I18N_MAX_LEN + 1, &len);
+    if (text == nullptr) {
+      buf.reset(new char[I18N_MAX_LEN + 1]);
+      text = this->parent_->translate_into(locale, key, buf.get(), I18N_MAX_LEN + 1, &len);
+    }
+    if (i > first)
+      stream->print(",");
+    const char *name = i18n_key_name_internal(key);
+    print_json_string(stream, name, strlen(name));
+    stream->print(":");
+    print_json_string(stream, text, len);
+  }
+  stream->print("}}");
+  request->send(stream);
+}
+
+void I18nCatalogHandler::handle_locale_(AsyncWebServerRequest *request) {
+  std::string code = request->arg("code").c_str();
+  if (i18n_locale_index_internal(code.c_str()) < 0) {
+    request->send(404, "text/plain", "Unknown locale");
+    return;
+  }
+  // Labels and listeners belong to the main loop, requests run on the web server task
+  this->defer([this, code]() { this->parent_->set_current_locale(code); });
+  request->send(200, "application/json", "{\"success\":true}");
+}
+
+}  // namespace i18n
+}  // namespace esphome
+
+#endif
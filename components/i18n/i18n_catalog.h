@@ -0,0 +1,68 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+
+#if defined(USE_I18N) && defined(USE_I18N_CATALOG)
+
+#include "esphome/components/web_server_base/web_server_base.h"
+#include "i18n.h"
+
+namespace esphome {
+namespace i18n {
+
+/**
+ * @brief Serves the translations and the locale over the web_server (`catalog:`)
+ *
+ * - `GET /i18n` lists the locales with their catalog versions and the current locale
+ * - `GET /i18n/catalog?locale=ru&offset=0` returns up to `page_size` translations
+ *   as JSON, with the catalog version as ETag; `next` is the offset of the next page
+ * - `POST /i18n/locale?code=ru` switches the locale
+ *
+ * Strings are written from the flash tables straight into the response,
+ * requests run on the web server task and only use reentrant lookups.
+ */
+class I18nCatalogHandler : public AsyncWebHandler, public Component {
+ public:
+  I18nCatalogHandler(I18nComponent *parent, web_server_base::WebServerBase *base) : parent_(parent), base_(base) {}
+
+  /**
+   * @brief Set the number of translations per catalog response
+   */
+  void set_page_size(size_t size) { this->page_size_ = size; }
+
+  /**
+   * @brief Register the handler with the web server
+   */
+  void setup() override;
+
+  /**
+   * @brief Dump configuration to logs
+   */
+  void dump_config() override;
+
+  /// After the network, like the web server itself
+  float get_setup_priority() const override { return setup_priority::WIFI - 1.0f; }
+
+  bool canHandle(AsyncWebServerRequest *request) const override;
+  void handleRequest(AsyncWebServerRequest *request) override;
+
+ protected:
+  /// Current locale and the locales with their versions
+  void handle_index_(AsyncWebServerRequest *request);
+
+  /// One page of the catalog of a locale
+  void handle_catalog_(AsyncWebServerRequest *request);
+
+  /// Switch the locale on the main loop
+  void handle_locale_(AsyncWebServerRequest *request);
+
+  I18nComponent *parent_;
+  web_server_base::WebServerBase *base_;
+  size_t page_size_{128};  ///< Translations per catalog response
+};
+
+}  // namespace i18n
+}  // namespace esphome
+
+#endif
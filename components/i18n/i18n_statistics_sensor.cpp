@@ -0,0 +1,37 @@
+#include "i18n_statistics_sensor.h"
+
+#if defined(USE_I18N) && defined(USE_SENSOR) && I18N_STATISTICS
+
+#include "i18n.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace i18n {
+
+static const char *const TAG = "i18n.sensor";
+
+void I18nStatisticsSensor::update() {
+  const auto &stats = esphome::i18n::i18n_stats;
+  if (this->lookups_sensor_ != nullptr)
+    this->lookups_sensor_->publish_state(stats.lookups);
+  if (this->misses_sensor_ != nullptr)
+    this->misses_sensor_->publish_state(stats.misses);
+  if (this->lookup_time_sensor_ != nullptr)
+    this->lookup_time_sensor_->publish_state(stats.lookups ? static_cast<float>(stats.micros) / stats.lookups : 0.0f);
+  if (this->unused_keys_sensor_ != nullptr)
+    this->unused_keys_sensor_->publish_state(I18nComponent::unused_key_count());
+}
+
+void I18nStatisticsSensor::dump_config() {
+  ESP_LOGCONFIG(TAG, "I18N Statistics Sensor");
+  LOG_UPDATE_INTERVAL(this);
+  LOG_SENSOR("  ", "Lookups", this->lookups_sensor_);
+  LOG_SENSOR("  ", "Missing keys", this->misses_sensor_);
+  LOG_SENSOR("  ", "Lookup time", this->lookup_time_sensor_);
+  LOG_SENSOR("  ", "Unused keys", this->unused_keys_sensor_);
+}
+
+}  // namespace i18n
+}  // namespace esphome
+
+#endif
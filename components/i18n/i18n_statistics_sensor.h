@@ -0,0 +1,54 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "generated/translations.h"
+
+#if defined(USE_I18N) && defined(USE_SENSOR) && I18N_STATISTICS
+
+#include "esphome/components/sensor/sensor.h"
+
+namespace esphome {
+namespace i18n {
+
+/**
+ * @brief Publishes the lookup statistics of `statistics: true` as sensors
+ *
+ * Usage in YAML:
+ * @code
+ * sensor:
+ *   - platform: i18n
+ *     lookups:
+ *       name: "Translation lookups"
+ *     lookup_time:
+ *       name: "Translation lookup time"
+ * @endcode
+ */
+class I18nStatisticsSensor : public PollingComponent {
+ public:
+  /**
+   * @brief Publish the current counters
+   */
+  void update() override;
+
+  /**
+   * @brief Dump configuration to logs
+   */
+  void dump_config() override;
+
+  void set_lookups_sensor(sensor::Sensor *sensor) { this->lookups_sensor_ = sensor; }
+  void set_misses_sensor(sensor::Sensor *sensor) { this->misses_sensor_ = sensor; }
+  void set_lookup_time_sensor(sensor::Sensor *sensor) { this->lookup_time_sensor_ = sensor; }
+  void set_unused_keys_sensor(sensor::Sensor *sensor) { this->unused_keys_sensor_ = sensor; }
+
+ protected:
+  sensor::Sensor *lookups_sensor_{nullptr};      ///< Lookups since boot
+  sensor::Sensor *misses_sensor_{nullptr};       ///< String keys not found since boot
+  sensor::Sensor *lookup_time_sensor_{nullptr};  ///< Average lookup time in microseconds
+  sensor::Sensor *unused_keys_sensor_{nullptr};  ///< Keys never looked up since boot
+};
+
+}  // namespace i18n
+}  // namespace esphome
+
+#endif
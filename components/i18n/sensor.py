@@ -0,0 +1,76 @@
+"""
+Lookup statistics of the i18n component as sensors (needs `statistics: true`).
+"""
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+import esphome.final_validate as fv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_ID,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+)
+
+from . import DOMAIN, i18n_ns
+
+DEPENDENCIES = ["i18n"]
+
+I18nStatisticsSensor = i18n_ns.class_("I18nStatisticsSensor", cg.PollingComponent)
+
+CONF_LOOKUPS = "lookups"
+CONF_MISSES = "misses"
+CONF_LOOKUP_TIME = "lookup_time"
+CONF_UNUSED_KEYS = "unused_keys"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(I18nStatisticsSensor),
+        cv.Optional(CONF_LOOKUPS): sensor.sensor_schema(
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_MISSES): sensor.sensor_schema(
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        # Average time of one lookup since boot
+        cv.Optional(CONF_LOOKUP_TIME): sensor.sensor_schema(
+            unit_of_measurement="µs",
+            accuracy_decimals=2,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_UNUSED_KEYS): sensor.sensor_schema(
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+).extend(cv.polling_component_schema("60s"))
+
+def _final_validate(config):
+    """The counters only exist when the i18n component collects them."""
+    i18n_config = fv.full_config.get().get(DOMAIN) or {}
+    if not i18n_config.get("statistics", False):
+        raise cv.Invalid("The i18n sensor needs 'statistics: true' in the i18n configuration")
+    return config
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    for key, setter in (
+        (CONF_LOOKUPS, var.set_lookups_sensor),
+        (CONF_MISSES, var.set_misses_sensor),
+        (CONF_LOOKUP_TIME, var.set_lookup_time_sensor),
+        (CONF_UNUSED_KEYS, var.set_unused_keys_sensor),
+    ):
+        if key in config:
+            sens = await sensor.new_sensor(config[key])
+            cg.add(setter(sens))
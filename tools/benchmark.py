@@ -0,0 +1,358 @@
+#!/usr/bin/env python3
+"""
+Host benchmark of the generated i18n lookup engine.
+
+Generates translation tables for synthetic locale sets with the component's own
+code generator, compiles them together with the component's i18n.cpp (against
+minimal stand-ins for the ESPHome headers) and a small driver for the host and
+reports the time per lookup and the size of the tables:
+
+    python3 tools/benchmark.py
+    python3 tools/benchmark.py --keys 1000 --locales 5 --key-lookup perfect_hash --compression none,huffman
+
+Needs a C++17 compiler (c++ or $CXX) and binutils `size`; ESPHome itself is not
+required. Host numbers compare strategies against each other, absolute figures
+on the device are best taken with `statistics: true`.
+"""
+
+import argparse
+import importlib.util
+import os
+import random
+import re
+import subprocess
+import sys
+import tempfile
+import types
+from pathlib import Path
+
+COMPONENT = Path(__file__).resolve().parent.parent / "components" / "i18n" / "__init__.py"
+COMPONENT_CPP = COMPONENT.parent / "i18n.cpp"
+
+def _load_component():
+    """Import the component with the ESPHome modules stubbed out, only the generator is used."""
+
+    class _Any:
+        def __getattr__(self, name):
+            return _Any()
+
+        def __call__(self, *args, **kwargs):
+            return _Any()
+
+        def __getitem__(self, key):
+            return _Any()
+
+    class _Invalid(Exception):
+        pass
+
+    for name in (
+        "esphome",
+        "esphome.codegen",
+        "esphome.config_validation",
+        "esphome.final_validate",
+        "esphome.core",
+        "esphome.helpers",
+        "esphome.const",
+        "esphome.components",
+        "esphome.components.lvgl",
+        "esphome.components.lvgl.types",
+    ):
+        if name not in sys.modules:
+            mod = types.ModuleType(name)
+            mod.__getattr__ = lambda attr: _Any()
+            sys.modules[name] = mod
+    sys.modules["esphome.config_validation"].Invalid = _Invalid
+    spec = importlib.util.spec_from_file_location("i18n_component", COMPONENT)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+# ------------------ Synthetic Locales ------------------
+
+_LATIN = "abcdefghijklmnopqrstuvwxyz     "
+_CYRILLIC = "абвгдежзийклмнопрстуфхцчшщыэюя     "
+_SHARED = ["OK", "Cancel", "On", "Off", "%", "°C"]
+
+def _random_text(rng: random.Random, alphabet: str) -> str:
+    """Mostly short UI strings, some sentences, a few long help texts."""
+    roll = rng.random()
+    n = rng.randint(3, 20) if roll < 0.7 else rng.randint(20, 60) if roll < 0.95 else rng.randint(60, 200)
+    return "".join(rng.choice(alphabet) for _ in range(n)).strip() or "x"
+
+def make_locales(keys: int, locales: int, seed: int = 1) -> dict[str, dict[str, str]]:
+    """Nested-style keys ("section12.item3"), every tenth text shared by all locales."""
+    rng = random.Random(seed)
+    names = [f"section{i // 20}.item{i % 20}" for i in range(keys)]
+    shared = {k: rng.choice(_SHARED) for k in names if rng.random() < 0.1}
+    result = {}
+    for n in range(locales):
+        alphabet = _CYRILLIC if n % 2 else _LATIN
+        result[f"l{n:02d}"] = {k: shared.get(k) or _random_text(rng, alphabet) for k in names}
+    return result
+
+# ------------------ Driver ------------------
+
+# Just enough of the ESPHome headers to build i18n.cpp for the host, without logging and LVGL
+_ESPHOME_STUBS = {
+    "esphome/core/component.h": r"""
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+namespace esphome {
+class Component {
+ public:
+  virtual ~Component() = default;
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual void on_shutdown() {}
+  void status_set_error() {}
+  void set_timeout(const std::string &name, uint32_t ms, std::function<void()> &&f) {}
+};
+}  // namespace esphome
+""",
+    "esphome/core/automation.h": r"""
+#pragma once
+namespace esphome {
+template<typename... Ts> class Trigger {
+ public:
+  void trigger(Ts... x) {}
+};
+template<typename... Ts> class Action {
+ public:
+  virtual void play(Ts... x) = 0;
+};
+template<typename T, typename... X> class TemplatableValue {
+ public:
+  T value(X... x) { return T(); }
+};
+}  // namespace esphome
+""",
+    "esphome/core/helpers.h": r"""
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+namespace esphome {
+template<typename F> class CallbackManager;
+template<typename... Ts> class CallbackManager<void(Ts...)> {
+ public:
+  void add(std::function<void(Ts...)> &&f) { this->callbacks_.push_back(std::move(f)); }
+  void call(Ts... args) {
+    for (auto &f : this->callbacks_) f(args...);
+  }
+ protected:
+  std::vector<std::function<void(Ts...)>> callbacks_;
+};
+using Mutex = std::mutex;
+using LockGuard = std::lock_guard<std::mutex>;
+inline uint32_t fnv1_hash(const char *s) {
+  uint32_t h = 2166136261u;
+  while (*s) h = (h * 16777619u) ^ (uint8_t) *s++;
+  return h;
+}
+}  // namespace esphome
+""",
+    "esphome/core/preferences.h": r"""
+#pragma once
+#include <cstdint>
+namespace esphome {
+struct ESPPreferenceObject {
+  template<typename T> bool save(const T *v) { return true; }
+  template<typename T> bool load(T *v) { return false; }
+};
+struct ESPPreferences {
+  template<typename T> ESPPreferenceObject make_preference(uint32_t key) { return {}; }
+  bool sync() { return true; }
+};
+inline ESPPreferences *global_preferences = new ESPPreferences();
+}  // namespace esphome
+""",
+    "esphome/core/log.h": r"""
+#pragma once
+#define ESP_LOGCONFIG(tag, ...) ((void) 0)
+#define ESP_LOGE ESP_LOGCONFIG
+#define ESP_LOGW ESP_LOGCONFIG
+#define ESP_LOGI ESP_LOGCONFIG
+#define ESP_LOGD ESP_LOGCONFIG
+#define ESP_LOGV ESP_LOGCONFIG
+#define ESP_LOGVV ESP_LOGCONFIG
+""",
+    "esphome/core/application.h": "#pragma once\n",
+    "esphome/core/hal.h": r"""
+#pragma once
+#include <chrono>
+#include <cstdint>
+namespace esphome {
+inline uint32_t micros() {
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return (uint32_t) std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
+}  // namespace esphome
+""",
+    "esphome/components/lvgl/lvgl_esphome.h": r"""
+#pragma once
+struct lv_obj_t {};
+inline lv_obj_t *lv_scr_act() { return nullptr; }
+inline lv_obj_t *lv_layer_top() { return nullptr; }
+inline lv_obj_t *lv_layer_sys() { return nullptr; }
+inline lv_obj_t *lv_obj_get_screen(lv_obj_t *obj) { return obj; }
+inline void lv_label_set_text(lv_obj_t *obj, const char *text) {}
+inline void lv_label_set_text_static(lv_obj_t *obj, const char *text) {}
+""",
+}
+
+_DRIVER = r"""
+#include "i18n.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace esphome::i18n;
+
+static const char* const NAMES[] = {
+@NAMES@
+};
+static constexpr size_t COUNT = sizeof(NAMES) / sizeof(NAMES[0]);
+static constexpr size_t OPS = @OPS@;
+static volatile size_t sink;
+
+// Nanoseconds per call of fn(i), i cycling through a fixed shuffled order of the keys
+template<typename F> static double measure(F fn) {
+  static size_t order[COUNT];
+  for (size_t i = 0; i < COUNT; ++i) order[i] = (i * 7919) % COUNT;
+  for (size_t i = 0; i < COUNT && i < OPS; ++i) fn(order[i]);  // warm up
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < OPS; ++i) fn(order[i % COUNT]);
+  auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  return ns / OPS;
+}
+
+int main() {
+  static I18nComponent component;
+  component.setup();
+  // Keys and locale codes as the component takes them, built once so the timings only cover the lookups
+  static std::vector<std::string> keys(NAMES, NAMES + COUNT);
+  static std::vector<std::string> codes(I18N_LOCALE_CODES, I18N_LOCALE_CODES + I18N_LOCALE_COUNT);
+  char buf[I18N_MAX_LEN + 1];
+  set_locale(I18N_LOCALE_CODES[I18N_LOCALE_COUNT - 1]);
+  printf("tr(Key) %.1f\n", measure([](size_t i) { sink += (size_t) tr((Key) i)[0]; }));
+  printf("tr(key) %.1f\n", measure([](size_t i) { sink += (size_t) tr(NAMES[i])[0]; }));
+  printf("tr(Key,buf) %.1f\n", measure([&](size_t i) { sink += tr((Key) i, buf, sizeof(buf)); }));
+  printf("translate(Key) %.1f\n", measure([](size_t i) { sink += component.translate((Key) i).size(); }));
+  printf("translate(key) %.1f\n", measure([](size_t i) { sink += component.translate(keys[i]).size(); }));
+  // translate(key, locale): the locale is resolved by code on every call
+  printf("translate(key,locale) %.1f\n",
+         measure([](size_t i) { sink += component.translate(keys[i], codes[i % codes.size()]).size(); }));
+  // Through the component, as set_locale() is once it is set up
+  printf("set_locale %.1f\n", measure([](size_t i) { set_locale(I18N_LOCALE_CODES[i % I18N_LOCALE_COUNT]); }));
+  return 0;
+}
+"""
+
+_COLUMNS = [
+    "tr(Key)",
+    "tr(key)",
+    "tr(Key,buf)",
+    "translate(Key)",
+    "translate(key)",
+    "translate(key,locale)",
+    "set_locale",
+]
+
+def _section_sizes(obj: Path) -> tuple[int, int, int]:
+    """
+    (code, read-only data, RAM) bytes of an object file, from `size -A`.
+
+    Thread-local buffers count towards RAM once; on the device every task reserves them.
+    """
+    out = subprocess.run(["size", "-A", str(obj)], check=True, capture_output=True, text=True).stdout
+    code = rodata = ram = 0
+    for line in out.splitlines():
+        m = re.match(r"(\.\S+)\s+(\d+)", line)
+        if not m:
+            continue
+        name, n = m.group(1), int(m.group(2))
+        if name.startswith(".text"):
+            code += n
+        elif name.startswith(".rodata") or name.startswith(".data.rel.ro"):
+            rodata += n
+        elif name.startswith((".data", ".bss", ".tdata", ".tbss")):
+            ram += n
+    return code, rodata, ram
+
+def run_case(i18n, cxx: str, keys: int, locales: int, key_lookup: str, compression: str, ops: int) -> dict:
+    """Generate, compile and run one configuration, returning its timings and sizes."""
+    locales_map = make_locales(keys, locales)
+    all_keys = sorted(locales_map["l00"])
+    codes = sorted(locales_map)
+    cpp = i18n._gen_translations_cpp(locales_map, "l00", all_keys, key_lookup, compression)
+    hdr = i18n._gen_translations_h(
+        all_keys,
+        i18n._max_string_len(locales_map),
+        codes,
+        "l00",
+        compression,
+        None,
+        i18n._format_templates(locales_map, "l00", all_keys),
+    )
+    names = ",\n".join(f'  "{i18n._cpp_escape_literal(k)}"' for k in all_keys)
+    with tempfile.TemporaryDirectory(prefix="i18n-bench-") as tmp:
+        work = Path(tmp)
+        (work / "generated").mkdir()
+        (work / "generated" / "translations.h").write_text(hdr, encoding="utf-8")
+        (work / "generated" / "translations.cpp").write_text(cpp, encoding="utf-8")
+        for name, text in _ESPHOME_STUBS.items():
+            (work / name).parent.mkdir(parents=True, exist_ok=True)
+            (work / name).write_text(text.lstrip("\n"), encoding="utf-8")
+        (work / "main.cpp").write_text(_DRIVER.replace("@NAMES@", names).replace("@OPS@", str(ops)), encoding="utf-8")
+        # The component itself is compiled from the tree
+        flags = ["-std=c++17", "-O2", "-DUSE_I18N", f"-I{work}", f"-I{COMPONENT.parent}"]
+        obj = work / "translations.o"
+        subprocess.run([cxx, *flags, "-c", str(work / "generated" / "translations.cpp"), "-o", str(obj)], check=True)
+        component = work / "i18n.o"
+        subprocess.run([cxx, *flags, "-c", str(COMPONENT_CPP), "-o", str(component)], check=True)
+        exe = work / "bench"
+        subprocess.run([cxx, *flags, str(work / "main.cpp"), str(obj), str(component), "-o", str(exe)], check=True)
+        out = subprocess.run([str(exe)], check=True, capture_output=True, text=True).stdout
+        sizes = _section_sizes(obj)
+    result = {name: float(ns) for name, ns in (line.rsplit(" ", 1) for line in out.splitlines())}
+    result["code"], result["rodata"], result["ram"] = sizes
+    return result
+
+def _csv_ints(text: str) -> list[int]:
+    return [int(v) for v in text.split(",") if v]
+
+def _csv(text: str) -> list[str]:
+    return [v.strip() for v in text.split(",") if v.strip()]
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--keys", type=_csv_ints, default=[100, 1000, 10000], help="key counts (default 100,1000,10000)")
+    parser.add_argument("--locales", type=_csv_ints, default=[2, 20], help="locale counts (default 2,20)")
+    parser.add_argument("--key-lookup", type=_csv, default=["linear", "binary", "perfect_hash"])
+    parser.add_argument("--compression", type=_csv, default=["none"])
+    parser.add_argument("--ops", type=int, default=200000, help="calls per measurement (default 200000)")
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "c++"), help="host C++ compiler")
+    args = parser.parse_args()
+
+    i18n = _load_component()
+    header = ["keys", "locales", "key_lookup", "compression", *(f"{c} ns" for c in _COLUMNS), "code B", "rodata B", "RAM B"]
+    print("| " + " | ".join(header) + " |")
+    print("|" + "---|" * len(header))
+    for keys in args.keys:
+        for locales in args.locales:
+            for compression in args.compression:
+                for key_lookup in args.key_lookup:
+                    r = run_case(i18n, args.cxx, keys, locales, key_lookup, compression, args.ops)
+                    cells = [str(keys), str(locales), key_lookup, compression]
+                    cells += [f"{r[c]:.1f}" for c in _COLUMNS]
+                    cells += [str(r["code"]), str(r["rodata"]), str(r["ram"])]
+                    print("| " + " | ".join(cells) + " |", flush=True)
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())